@@ -0,0 +1,786 @@
+#ifndef LAB4_H
+#define LAB4_H
+
+#include <iostream>
+#include <fstream>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <iomanip>
+#include <chrono>
+#include <cstdint>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <cstdlib>
+#include <string>
+#include <stdexcept>
+#include <climits>
+#include <sstream>
+#include <cstdio>
+
+using namespace std;
+
+/**
+ *  @brief Class generator_1 used to generate pseudorandom numbers using the Linear congruent method
+ */
+
+class generator_1{
+public:
+
+    /**
+     *  @brief Class fields
+     *  @details Initial value for the generator, minimum possible value, maximum possible value
+     *  @code
+        uint64_t start;
+        int minV;
+        int maxV;
+     *  @endcode
+     */
+
+    uint64_t start;
+    int minV;
+    int maxV;
+
+    /**
+    *  @brief Parameterized constructor
+    *  @details Used for initialization an object of the class according to the parameters
+    *  @param start_ parameter with data type uint64_t, minV_ parameter with data type int, maxV_ parameter with data type int
+    *  @return There is no return value
+    *  @code
+        constexpr generator_1(uint64_t start_, int minV_, int maxV_) : start(start_), minV(minV_), maxV(maxV_){
+        }
+    *  @endcode
+    */
+
+    constexpr generator_1(uint64_t start_, int minV_, int maxV_) : start(start_), minV(minV_), maxV(maxV_){
+    }
+
+    /**
+     *  @brief Number of different raw values
+     *  @details raw() gives numbers from 0 to raw_range - 1
+     */
+
+    static constexpr uint64_t raw_range = uint64_t(1) << 32;
+
+    /**
+     *  @brief Period of the generator
+     *  @details The multiplier is 3 modulo 4, so the period is 2^30, not 2^32
+     */
+
+    static constexpr uint64_t period = uint64_t(1) << 30;
+
+    /**
+     *  @brief Search function for the next raw number
+     *  @details Used for moving to the next state of the generator without reducing it to the range
+     *  @param There is no parametrs
+     *  @return The new state, a number from 0 to raw_range - 1
+     *  @code
+        constexpr uint64_t raw() {
+            start = (uint32_t)((uint32_t)(start) * 19004983u + 19004989u);
+            return start;
+        }
+     *  @endcode
+     */
+
+    constexpr uint64_t raw() {
+        start = (uint32_t)((uint32_t)(start) * 19004983u + 19004989u);
+        return start;
+    }
+
+    /**
+     *  @brief Search function for the next random number
+     *  @details Used for searching for the next element from a sequence of pseudorandom numbers
+     *  @param There is no parametrs
+     *  @return The next element
+     *  @code
+        constexpr int next() {
+            return minV + raw() % (maxV - minV);
+        }
+     *  @endcode
+     */
+
+    constexpr int next() {
+        return minV + raw() % (maxV - minV);
+    }
+
+    /**
+     *  @brief Jump-ahead function
+     *  @details Used for moving the generator forward by the given number of steps in logarithmic time, as if next() was called that many times
+     *  @param steps parameter with data type uint64_t
+     *  @return There is no return value
+     */
+
+    constexpr void jump(uint64_t steps) {
+        uint32_t mult = 19004983, plus = 19004989, accMult = 1, accPlus = 0;
+        if (steps == 0)
+            return;
+        while (steps > 0){
+            if (steps & 1){
+                accMult = accMult * mult;
+                accPlus = accPlus * mult + plus;
+            }
+            plus = (mult + 1) * plus;
+            mult = mult * mult;
+            steps >>= 1;
+        }
+        start = (uint32_t)(accMult * (uint32_t)(start) + accPlus);
+    }
+};
+
+class generator_2{
+public:
+
+    /**
+     *  @brief Class fields
+     *  @details Initial value for the generator, minimum possible value, maximum possible value, random maximum
+     *  @code
+        uint64_t start;
+        static constexpr uint64_t randM = 7837654853;
+        int minV;
+        int maxV;
+     *  @endcode
+     */
+
+    uint64_t start;
+    static constexpr uint64_t randM = 7837654853;
+    int minV;
+    int maxV;
+
+    /**
+    *  @brief Parameterized constructor
+    *  @details Used for initialization an object of the class according to the parameters
+    *  @param start_ parameter with data type uint64_t, minV_ parameter with data type int, maxV_ parameter with data type int
+    *  @return There is no return value
+    *  @code
+        constexpr generator_2(uint64_t start_, int minV_, int maxV_) : start(start_), minV(minV_), maxV(maxV_){
+        }
+    *  @endcode
+    */
+
+    constexpr generator_2(uint64_t start_, int minV_, int maxV_) : start(start_), minV(minV_), maxV(maxV_){
+    }
+
+    /**
+     *  @brief Number of different raw values
+     *  @details raw() gives numbers from 0 to raw_range - 1
+     */
+
+    static constexpr uint64_t raw_range = randM;
+
+    /**
+     *  @brief Period of the generator
+     *  @details 0, because the period depends on the initial value and there is no jump-ahead. Most initial values end up in the
+     *  same short cycles (13896 numbers for the initial value 6089), so different initial values do not give independent streams
+     */
+
+    static constexpr uint64_t period = 0;
+
+    /**
+     *  @brief Search function for the next raw number
+     *  @details Used for moving to the next state of the generator without reducing it to the range
+     *  @param There is no parametrs
+     *  @return The new state, a number from 0 to raw_range - 1
+     *  @code
+        constexpr uint64_t raw() {
+            start ^= start << 11;
+            start ^= start >> 13;
+            start ^= start << 7;
+            start %= randM;
+            return start;
+        }
+     *  @endcode
+     */
+
+    constexpr uint64_t raw() {
+        start ^= start << 11;
+        start ^= start >> 13;
+        start ^= start << 7;
+        start %= randM;
+        return start;
+    }
+
+    /**
+     *  @brief Search function for the next random number
+     *  @details Used for searching for the next element from a sequence of pseudorandom numbers
+     *  @param There is no parametrs
+     *  @return The next element
+     *  @code
+        constexpr int next() {
+            return minV + raw() % (maxV - minV);
+        }
+     *  @endcode
+     */
+
+    constexpr int next() {
+        return minV + raw() % (maxV - minV);
+    }
+};
+
+/**
+ *  @brief Distance between the streams of generator_1
+ *  @details The period of generator_1 is 2^30, so 64 streams of 2^24 numbers each do not overlap. Stream 64 is stream 0 again
+ */
+
+const uint64_t stream_stride = uint64_t(1) << 24;
+
+/**
+ *  @brief Seed derivation function
+ *  @details Used for mixing a value into a well spread 64-bit seed (SplitMix64)
+ *  @param x parameter with data type uint64_t
+ *  @return The mixed value
+ */
+
+constexpr uint64_t splitmix(uint64_t x){
+    x += 0x9E3779B97F4A7C15;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EB;
+    return x ^ (x >> 31);
+}
+
+/**
+ *  @brief Stream function for generator_1
+ *  @details Used for getting the independent stream with the given number, stream 0 is the generator itself
+ *  @param gen parameter with data type generator_1, index parameter with data type uint64_t
+ *  @return The generator moved forward by index * stream_stride steps
+ *  @code
+    constexpr generator_1 make_stream(generator_1 gen, uint64_t index){
+        gen.jump(index * stream_stride);
+        return gen;
+    }
+ *  @endcode
+ */
+
+constexpr generator_1 make_stream(generator_1 gen, uint64_t index){
+    gen.jump(index * stream_stride);
+    return gen;
+}
+
+/**
+ *  @brief Stream function for generator_2
+ *  @details XOR-Shift with the modulo step has no jump-ahead, so the stream gets a seed derived from the initial value and the stream number.
+ *  These streams are not independent: they fall into the same short cycles as stream 0, see generator_2::period
+ *  @param gen parameter with data type generator_2, index parameter with data type uint64_t
+ *  @return The generator with the derived initial value
+ */
+
+constexpr generator_2 make_stream(generator_2 gen, uint64_t index){
+    if (index == 0)
+        return gen;
+    gen.start = splitmix(gen.start ^ splitmix(index));
+    if (gen.start == 0)
+        gen.start = index;
+    return gen;
+}
+
+/**
+ *  @brief Number of independent streams
+ *  @details 64 for generator_1, only stream 0 for the generators without a known period
+ *  @param There is no parameters
+ *  @return The number of streams from make_stream that do not overlap
+ *  @code
+    template <class G>
+    constexpr uint64_t stream_limit(){
+        return G::period == 0 ? 1 : G::period / stream_stride;
+    }
+ *  @endcode
+ */
+
+template <class G>
+constexpr uint64_t stream_limit(){
+    return G::period == 0 ? 1 : G::period / stream_stride;
+}
+
+/**
+ *  @brief Length of one stream
+ *  @details Numbers that can be taken from one stream of make_stream before it runs into the next one
+ *  @param There is no parameters
+ *  @return stream_stride, or the biggest uint64_t for the generators with only one stream
+ *  @code
+    template <class G>
+    constexpr uint64_t stream_length(){
+        return G::period == 0 ? UINT64_MAX : stream_stride;
+    }
+ *  @endcode
+ */
+
+template <class G>
+constexpr uint64_t stream_length(){
+    return G::period == 0 ? UINT64_MAX : stream_stride;
+}
+
+/**
+ *  @brief Engine name functions
+ *  @details Used for naming the engine together with its constants, so saved results of other engines or changed constants are never mixed up
+ *  @param gen parameter with data type generator_1 or generator_2
+ *  @return The name of the engine
+ */
+
+inline string engine_key(const generator_1 &){
+    return "lcg-19004983-19004989";
+}
+
+inline string engine_key(const generator_2 &gen){
+    return "xorshift-11-13-7-" + to_string(gen.randM);
+}
+
+/**
+ *  @brief Shard function for generator_1
+ *  @details Used for getting the part of the sequence that starts with the number first, so the shards together give exactly the sequence of one process
+ *  @param gen parameter with data type generator_1, shard parameter with data type uint64_t, first parameter with data type uint64_t
+ *  @return The generator moved forward by first steps
+ *  @code
+    constexpr generator_1 make_shard(generator_1 gen, uint64_t, uint64_t first){
+        gen.jump(first);
+        return gen;
+    }
+ *  @endcode
+ */
+
+constexpr generator_1 make_shard(generator_1 gen, uint64_t, uint64_t first){
+    gen.jump(first);
+    return gen;
+}
+
+/**
+ *  @brief Shard function for generator_2
+ *  @details XOR-Shift has no jump-ahead, and the streams of make_stream fall into the same short cycles, so the shards would not be
+ *  disjoint parts of one sequence. Only one shard is allowed, it is the whole sequence
+ *  @param gen parameter with data type generator_2, shard parameter with data type uint64_t, first parameter with data type uint64_t
+ *  @return The generator itself for the shard 0, invalid_argument is thrown for the other shards
+ *  @code
+    constexpr generator_2 make_shard(generator_2 gen, uint64_t shard, uint64_t first){
+        if (shard != 0 || first != 0)
+            throw invalid_argument("generator_2 has no jump-ahead and cannot be split into shards");
+        return gen;
+    }
+ *  @endcode
+ */
+
+constexpr generator_2 make_shard(generator_2 gen, uint64_t shard, uint64_t first){
+    if (shard != 0 || first != 0)
+        throw invalid_argument("generator_2 has no jump-ahead and cannot be split into shards");
+    return gen;
+}
+
+/**
+ *  @brief Table function
+ *  @details Used for filling a table with the first N numbers of the generator, the table can be built at compile time
+ *  @param gen parameter with data type G
+ *  @return The array of N pseudorandom numbers
+ *  @code
+    template <size_t N, class G>
+    constexpr array<int, N> make_table(G gen){
+        array<int, N> table{};
+        for (size_t i = 0; i < N; i++)
+            table[i] = gen.next();
+        return table;
+    }
+ *  @endcode
+ */
+
+template <size_t N, class G>
+constexpr array<int, N> make_table(G gen){
+    array<int, N> table{};
+    for (size_t i = 0; i < N; i++)
+        table[i] = gen.next();
+    return table;
+}
+
+/**
+ *  @brief Class generator_pool used to give every thread its own generator
+ *  @details Each thread gets its own stream from make_stream on the first call, after that next() uses no synchronization.
+ *  The streams belong to the pool and are freed with it. A stream is not given back when its thread ends, so one pool serves
+ *  at most stream_limit<G>() threads (64 for generator_1, 1 for generator_2) and throws length_error for the next one.
+ *  next() throws length_error when the thread has taken stream_length<G>() numbers, because further numbers would repeat
+ *  the stream of another thread. Every stream takes its own cache line, so the threads do not share the lines they write
+ */
+
+template <class G>
+class generator_pool{
+public:
+
+    /**
+     *  @brief Class fields
+     *  @details Initial value for the generators, minimum possible value, maximum possible value
+     *  @code
+        uint64_t start;
+        int minV;
+        int maxV;
+     *  @endcode
+     */
+
+    uint64_t start;
+    int minV;
+    int maxV;
+
+    /**
+    *  @brief Parameterized constructor
+    *  @details Used for initialization an object of the class according to the parameters
+    *  @param start_ parameter with data type uint64_t, minV_ parameter with data type int, maxV_ parameter with data type int
+    *  @return There is no return value
+    */
+
+    generator_pool(uint64_t start_, int minV_, int maxV_){
+        start = start_;
+        minV = minV_;
+        maxV = maxV_;
+        lock_guard<mutex> guard(registry_lock());
+        id = next_id()++;
+        live().push_back(id);
+    }
+
+    generator_pool(const generator_pool &) = delete;
+    generator_pool& operator=(const generator_pool &) = delete;
+
+    /**
+    *  @brief Destructor
+    *  @details Used for freeing the streams of all threads
+    */
+
+    ~generator_pool(){
+        lock_guard<mutex> guard(registry_lock());
+        live().erase(find(live().begin(), live().end(), id));
+    }
+
+    /**
+     *  @brief Function for getting the generator of the current thread
+     *  @details Used for creating the stream of the thread on the first call and returning it on the next calls.
+     *  The numbers taken directly from this generator are not counted, the caller must keep within stream_length<G>()
+     *  @param There is no parametrs
+     *  @return The generator of the current thread
+     */
+
+    G& local() {
+        return slot().gen;
+    }
+
+    /**
+     *  @brief Search function for the next random number
+     *  @details Used for searching for the next element from the stream of the current thread
+     *  @param There is no parametrs
+     *  @return The next element
+     *  @code
+        int next() {
+            stream &s = slot();
+            if (s.left == 0)
+                throw length_error("generator_pool: the stream of the thread is used up");
+            s.left--;
+            return s.gen.next();
+        }
+     *  @endcode
+     */
+
+    int next() {
+        stream &s = slot();
+        if (s.left == 0)
+            throw length_error("generator_pool: the stream of the thread is used up");
+        s.left--;
+        return s.gen.next();
+    }
+
+private:
+    struct alignas(64) stream{
+        G gen;
+        uint64_t left;
+    };
+
+    size_t id;
+    mutex lock;
+    vector <unique_ptr<stream>> streams;
+
+    stream& slot() {
+        thread_local size_t last_id = SIZE_MAX;
+        thread_local stream *last = nullptr;
+        if (last_id != id){
+            last = &attach();
+            last_id = id;
+        }
+        return *last;
+    }
+
+    stream& attach() {
+        thread_local vector <pair<size_t, stream*>> attached;
+
+        for (auto &a : attached)
+            if (a.first == id)
+                return *a.second;
+
+        {
+            lock_guard<mutex> guard(registry_lock());
+            attached.erase(remove_if(attached.begin(), attached.end(), [](const pair<size_t, stream*> &a){
+                return find(live().begin(), live().end(), a.first) == live().end();
+            }), attached.end());
+        }
+
+        lock_guard<mutex> guard(lock);
+        if (streams.size() >= stream_limit<G>())
+            throw length_error("generator_pool: no independent streams left for a new thread");
+        streams.emplace_back(new stream{make_stream(G(start, minV, maxV), streams.size()), stream_length<G>()});
+        attached.emplace_back(id, streams.back().get());
+        return *streams.back();
+    }
+
+    static size_t& next_id() {
+        static size_t ids = 0;
+        return ids;
+    }
+
+    static vector <size_t>& live() {
+        static vector <size_t> ids;
+        return ids;
+    }
+
+    static mutex& registry_lock() {
+        static mutex m;
+        return m;
+    }
+};
+
+/**
+ *  @brief The function of measuring the generator pool on many threads
+ *  @details Used for comparing the time of the thread pool with the time of one generator shared behind a mutex for 1 to 64 threads.
+ *  Only the generators with 64 streams can be measured, see stream_limit
+ *  @param There is no parameters
+ *  @return There is no return value
+ */
+
+template <class G>
+void pool_scaling(){
+    const long volume = 1000000;
+
+    for (int count = 1; count <= 64; count *= 2){
+        generator_pool<G> pool(6089, 0, 10000);
+        G shared(6089, 0, 10000);
+        mutex lock;
+        atomic<long> sink{0};
+        vector <thread> workers;
+
+        auto s_t = chrono::steady_clock::now();
+        for (int t = 0; t < count; t++)
+            workers.emplace_back([&]{
+                long sum = 0;
+                for (long i = 0; i < volume; i++)
+                    sum += pool.next();
+                sink += sum;
+            });
+        for (auto &w : workers)
+            w.join();
+        auto pool_t = chrono::duration_cast<std::chrono::microseconds>(chrono::steady_clock::now() - s_t).count();
+        workers.clear();
+
+        s_t = chrono::steady_clock::now();
+        for (int t = 0; t < count; t++)
+            workers.emplace_back([&]{
+                long sum = 0;
+                for (long i = 0; i < volume; i++){
+                    lock_guard<mutex> guard(lock);
+                    sum += shared.next();
+                }
+                sink += sum;
+            });
+        for (auto &w : workers)
+            w.join();
+        auto mutex_t = chrono::duration_cast<std::chrono::microseconds>(chrono::steady_clock::now() - s_t).count();
+
+        cout << "Threads\t" << count << "\tpool time\t" << pool_t << "\tmutex time\t" << mutex_t << "\n";
+    }
+}
+
+/**
+ *  @brief Class analys_state used to accumulate the statistics of a sequence
+ *  @details Keeps the volume, the sum, the sum of squares and the ten intervals of the chi-square criterion,
+ *  so the report of analys can be made without keeping the sequence in memory
+ */
+
+class analys_state{
+public:
+
+    /**
+     *  @brief Class fields
+     *  @details Volume, sum of the numbers, sum of the squares of the numbers, counts of the numbers in the intervals of width 1000
+     *  @code
+        uint64_t volume = 0;
+        int64_t sum = 0;
+        uint64_t squares = 0;
+        array<uint64_t, 10> bins{};
+     *  @endcode
+     */
+
+    uint64_t volume = 0;
+    int64_t sum = 0;
+    uint64_t squares = 0;
+    array<uint64_t, 10> bins{};
+
+    /**
+     *  @brief Function for adding the next number
+     *  @param v parameter with data type int
+     *  @return There is no return value
+     *  @code
+        void add(int v) {
+            volume++;
+            sum += v;
+            squares += (uint64_t)((int64_t)v * v);
+            if (v >= 0 && v < 10000)
+                bins[v / 1000]++;
+        }
+     *  @endcode
+     */
+
+    void add(int v) {
+        volume++;
+        sum += v;
+        squares += (uint64_t)((int64_t)v * v);
+        if (v >= 0 && v < 10000)
+            bins[v / 1000]++;
+    }
+
+    /**
+     *  @brief Function for merging the statistics of another part of the sequence
+     *  @param other parameter with data type analys_state
+     *  @return There is no return value
+     *  @code
+        void merge(const analys_state &other) {
+            volume += other.volume;
+            sum += other.sum;
+            squares += other.squares;
+            for (size_t i = 0; i < bins.size(); i++)
+                bins[i] += other.bins[i];
+        }
+     *  @endcode
+     */
+
+    void merge(const analys_state &other) {
+        volume += other.volume;
+        sum += other.sum;
+        squares += other.squares;
+        for (size_t i = 0; i < bins.size(); i++)
+            bins[i] += other.bins[i];
+    }
+
+    /**
+     *  @brief Comparison operator
+     *  @param other parameter with data type analys_state
+     *  @return True if both states have the same volume, sums and bins
+     *  @code
+        bool operator==(const analys_state &other) const {
+            return volume == other.volume && sum == other.sum && squares == other.squares && bins == other.bins;
+        }
+     *  @endcode
+     */
+
+    bool operator==(const analys_state &other) const {
+        return volume == other.volume && sum == other.sum && squares == other.squares && bins == other.bins;
+    }
+
+    /**
+     *  @brief Functions for the mean, the standard deviation and the value of the chi-square criterion
+     *  @param There is no parametrs
+     *  @return The value for the accumulated numbers
+     */
+
+    double mean() const;
+    double deviation() const;
+    double criterion() const;
+
+    /**
+     *  @brief Report function
+     *  @details Used for printing the mean, deviation, coefficient of variation and the value of the chi-square criterion in the same form as analys
+     *  @param out parameter with data type ostream
+     *  @return There is no return value
+     */
+
+    void report(ostream &out) const;
+
+    /**
+     *  @brief Functions for writing and reading the state
+     *  @details The state is written as one line of numbers separated by spaces
+     *  @param out parameter with data type ostream, in parameter with data type istream
+     *  @return load returns false if there was no full state to read
+     */
+
+    void save(ostream &out) const;
+    bool load(istream &in);
+};
+
+/**
+ *  @brief The function of analyzing the received sequence of pseudorandom numbers
+ *  @details Used for finding the mean, deviation, coefficient of variation and the value of the chi-square criterion
+ *  @param array the vector of pseudorandom numbers with data type int, passed by reference without a copy, out the stream for the report, cout by default
+ *  @return There is no return value
+ */
+
+void analys(const vector <int> &array, ostream &out = cout);
+
+/**
+ *  @brief The function of analyzing a sequence with the results saved on disk
+ *  @details The results are saved in the directory dir, in one file for each engine, initial value and range. Every line of the file
+ *  is a checkpoint with the state of the generator after the volume and the analys_state. The nearest checkpoint not bigger than
+ *  volume is taken and only the numbers after it are generated. A line that is not finished with the end of line or has wrong fields
+ *  is skipped, so a run stopped in the middle of the writing loses only its own checkpoint. The new checkpoint is written together
+ *  with the good old ones to a temporary file that replaces the old file with rename, so the file is never seen half-written.
+ *  When several processes write the same file, the last rename wins and the checkpoints of the others can be lost, but never broken
+ *  @param gen parameter with data type G, volume parameter with data type uint64_t, dir parameter with data type string
+ *  @return The statistics of the sequence, gen is moved to the end of the sequence
+ */
+
+template <class G>
+analys_state cached_analys(G &gen, uint64_t volume, const string &dir){
+    string file = dir + "/" + engine_key(gen) + "_" + to_string(gen.start) + "_" + to_string(gen.minV) + "_" + to_string(gen.maxV) + ".txt";
+    analys_state state;
+    uint64_t end = gen.start;
+    vector <string> lines;
+
+    ifstream in(file);
+    string line;
+    while (getline(in, line)){
+        if (in.eof())
+            break;
+        istringstream fields(line);
+        analys_state saved;
+        uint64_t saved_end;
+        string rest;
+        if (!(fields >> saved_end) || !saved.load(fields) || fields >> rest)
+            continue;
+        lines.push_back(line);
+        if (saved.volume <= volume && saved.volume >= state.volume){
+            state = saved;
+            end = saved_end;
+        }
+    }
+    in.close();
+
+    gen.start = end;
+    if (state.volume < volume){
+        for (uint64_t i = state.volume; i < volume; i++)
+            state.add(gen.next());
+
+        string temp = file + "." + to_string(chrono::steady_clock::now().time_since_epoch().count()) + "."
+                      + to_string(hash<thread::id>()(this_thread::get_id())) + ".tmp";
+        ofstream out(temp);
+        for (auto &l : lines)
+            out << l << "\n";
+        out << gen.start << " ";
+        state.save(out);
+        out.close();
+        if (!out || rename(temp.c_str(), file.c_str()) != 0)
+            remove(temp.c_str());
+    }
+    return state;
+}
+
+/**
+ *  @brief The function of the laboratory work
+ *  @details Used for generating samples of a certain volume, measuring the time of sample generation and analyzing the samples.
+ *  The generator is taken from the first argument of the command line, or asked for if there are no arguments.
+ *  If the second argument is given, it is the directory for cached_analys: the samples are analyzed from the cache without measuring
+ *  the time, the next arguments are the volumes (the standard ten volumes by default)
+ *  @param argc parameter with data type int, argv parameter with data type array of char*
+ *  @return The exit code
+ */
+
+int run(int argc, char **argv);
+
+#endif
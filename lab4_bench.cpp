@@ -0,0 +1,183 @@
+#include "lab4_shuffle.h"
+#include "lab4_monitor.h"
+#include <sstream>
+#include <numeric>
+#include <random>
+
+double median(vector <double> times){
+    sort(times.begin(), times.end());
+    return times[times.size() / 2];
+}
+
+template <class G>
+void sweep(const char *name){
+    const int runs = 7;
+    G puk(6089, 0, 10000);
+    ostringstream sink;
+
+    for (long volume : {100, 500, 1000, 5000, 10000, 50000, 100000, 500000, 1000000, 5000000}){
+        long repeats = max(1L, 1000000 / volume);
+        vector <int> array;
+        vector <double> gen_t, analys_t;
+        array.reserve(volume);
+
+        for (int run = 0; run < runs; run++){
+            auto s_t = chrono::steady_clock::now();
+            for (long r = 0; r < repeats; r++){
+                array.clear();
+                for (long i = 0; i < volume; i++)
+                    array.push_back(puk.next());
+            }
+            gen_t.push_back(chrono::duration<double, nano>(chrono::steady_clock::now() - s_t).count() / (volume * repeats));
+
+            s_t = chrono::steady_clock::now();
+            for (long r = 0; r < repeats; r++){
+                analys(array, sink);
+                sink.str("");
+            }
+            analys_t.push_back(chrono::duration<double, nano>(chrono::steady_clock::now() - s_t).count() / (volume * repeats));
+        }
+
+        cout << name << "\t" << volume << "\t" << fixed << setprecision(3) << median(gen_t) << "\t" << median(analys_t) << "\n";
+    }
+}
+
+template <class F>
+void time_shuffle(const char *name, vector <int> &array, F shuffle){
+    iota(array.begin(), array.end(), 0);
+
+    auto s_t = chrono::steady_clock::now();
+    shuffle();
+    double shuffle_t = chrono::duration<double, nano>(chrono::steady_clock::now() - s_t).count();
+
+    cout << name << "\t" << fixed << setprecision(3) << shuffle_t / 1e6 << "\t" << shuffle_t / array.size() << "\n";
+}
+
+void shuffles(size_t volume){
+    vector <int> array(volume);
+    generator_1 lcg(6089, 0, 10000);
+    generator_2 xorshift(6089, 0, 10000);
+    mt19937_64 mt(6089);
+
+    cout << "Shuffle of " << volume << " numbers, " << thread::hardware_concurrency() << " threads\n";
+    cout << "Method\tms\tns/element\n";
+    time_shuffle("std::shuffle mt19937_64", array, [&]{ shuffle(array.begin(), array.end(), mt); });
+    time_shuffle("std::shuffle LCPRNG", array, [&]{ shuffle(array.begin(), array.end(), engine_bits<generator_1>(lcg)); });
+    time_shuffle("fisher_yates LCPRNG", array, [&]{ fisher_yates(array.begin(), array.end(), lcg); });
+    time_shuffle("fisher_yates XOR-Shift", array, [&]{ fisher_yates(array.begin(), array.end(), xorshift); });
+    time_shuffle("parallel_shuffle LCPRNG", array, [&]{ parallel_shuffle(array.begin(), array.end(), lcg); });
+    time_shuffle("parallel_shuffle XOR-Shift", array, [&]{ parallel_shuffle(array.begin(), array.end(), xorshift); });
+}
+
+volatile long sink;
+
+/**
+ *  @brief Function for the median of the overhead with its spread
+ *  @details The bounds are the order statistics n / 2 -+ sqrt(n), a 95% confidence interval of the median
+ *  @param overhead parameter with data type vector of double
+ *  @return The text "median (lower bound .. upper bound)"
+ */
+
+string median_interval(vector <double> overhead){
+    sort(overhead.begin(), overhead.end());
+    size_t n = overhead.size(), k = (size_t)ceil(sqrt((double)n));
+    ostringstream text;
+    text << fixed << setprecision(2) << overhead[n / 2] << "% (" << overhead[n / 2 - min(k, n / 2)] << ".." << overhead[min(n - 1, n / 2 + k)] << ")";
+    return text.str();
+}
+
+/**
+ *  @brief Functions for timing one chunk
+ *  @details The engine is moved into a local object for the loop, so its state can stay in registers as in a loop of the caller
+ *  @param gen parameter with data type E, out parameter with data type int pointer, n parameter with data type uint64_t
+ *  @return The sum of the numbers for draw
+ */
+
+template <class E>
+__attribute__((noinline)) long draw(E &gen, uint64_t n){
+    E local = move(gen);
+    long sum = 0;
+    for (uint64_t i = 0; i < n; i++)
+        sum += local.next();
+    gen = move(local);
+    return sum;
+}
+
+template <class G>
+__attribute__((noinline)) void draw_into(G &gen, int *out, uint64_t n){
+    G local = gen;
+    for (uint64_t i = 0; i < n; i++)
+        out[i] = local.next();
+    gen = local;
+}
+
+template <class G>
+__attribute__((noinline)) void fill_into(monitored<G> &gen, int *out, uint64_t n){
+    monitored<G> local = move(gen);
+    local.fill(out, n);
+    gen = move(local);
+}
+
+template <class G>
+void monitor_overhead(const char *name, uint64_t volume){
+    const int runs = 801;
+    G plain(6089, 0, 10000), plain_fill(6089, 0, 10000);
+    monitored<G> watched(G(6089, 0, 10000)), watched_fill(G(6089, 0, 10000));
+    uint64_t chunk = max<uint64_t>(1, volume / runs);
+    vector <int> buffer(chunk);
+    vector <double> plain_t, watched_t, overhead, fill_overhead;
+    long sum = 0;
+
+    for (int run = 0; run < runs; run++){
+        double t[4];
+        for (int k = 0; k < 4; k++){
+            int method = (k + run) % 4;
+            auto s_t = chrono::steady_clock::now();
+            if (method == 0)
+                sum += draw(plain, chunk);
+            else if (method == 1)
+                sum += draw(watched, chunk);
+            else if (method == 2)
+                draw_into(plain_fill, buffer.data(), chunk);
+            else
+                fill_into(watched_fill, buffer.data(), chunk);
+            t[method] = chrono::duration<double, nano>(chrono::steady_clock::now() - s_t).count() / chunk;
+            sum += buffer[run % chunk];
+        }
+        plain_t.push_back(t[0]);
+        watched_t.push_back(t[1]);
+        overhead.push_back((t[1] / t[0] - 1) * 100);
+        fill_overhead.push_back((t[3] / t[2] - 1) * 100);
+    }
+    sink = sum;
+
+    monitor_snapshot snap = watched.snapshot();
+    cout << name << "\t" << fixed << setprecision(3) << median(plain_t) << "\t" << median(watched_t) << "\t" << median_interval(overhead) << "\t"
+         << median_interval(fill_overhead) << "\t" << defaultfloat << snap.window.mean() << "\t" << snap.window.criterion() << "\t" << snap.cycle << "\n";
+}
+
+int main(int argc, char **argv){
+    if (argc > 1 && string(argv[1]) == "shuffle"){
+        shuffles(argc > 2 ? strtoull(argv[2], nullptr, 10) : 100000000);
+        return 0;
+    }
+
+    if (argc > 1 && string(argv[1]) == "monitor"){
+        uint64_t volume = argc > 2 ? strtoull(argv[2], nullptr, 10) : 100000000;
+        cout << "Monitor of " << volume << " numbers in 801 interleaved runs, median overhead with its 95% confidence interval\n";
+        cout << "Generator\tns/number\tmonitored ns/number\tnext() overhead\tfill() overhead\twindow mean\twindow criterion\tcycle\n";
+        monitor_overhead<generator_1>("LCPRNG", volume);
+        monitor_overhead<generator_2>("XOR-Shift", volume);
+        return 0;
+    }
+
+    cout << "Generator\tVolume\tns/number\tanalys ns/number\n";
+    sweep<generator_1>("LCPRNG");
+    sweep<generator_2>("XOR-Shift");
+
+    if (argc > 1 && string(argv[1]) == "pool"){
+        cout << "\nLCPRNG pool, 1000000 numbers per thread\n";
+        pool_scaling<generator_1>();
+        cout << "\nXOR-Shift has no independent streams, so its pool serves only one thread\n";
+    }
+}
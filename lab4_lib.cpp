@@ -0,0 +1,289 @@
+#include "lab4.h"
+#include <filesystem>
+
+double analys_state::mean() const {
+    return (double)sum / volume;
+}
+
+double analys_state::deviation() const {
+    double deviation = (double)(((long double)squares - (long double)sum * mean()) / volume);
+    return pow(max(deviation, 0.0), 0.5);
+}
+
+double analys_state::criterion() const {
+    double expected = volume / 10.0, xisum = 0.0;
+
+    for (long long i = 0; i < 10; i++)
+        xisum = xisum + (bins[i] - expected) * (bins[i] - expected) / expected;
+    return xisum;
+}
+
+void analys_state::report(ostream &out) const {
+    out << "Volume " << volume << "\n\n";
+
+    out << "Mean " << mean() << "\n\n";
+
+    out << "Standard deviation " << deviation() << "\n\n";
+
+    out << "Coefficient of variation " << deviation() / mean() << "\n\n";
+
+    out << "___Value of criterion is " << criterion() << "___\n\n";
+}
+
+void analys_state::save(ostream &out) const {
+    out << volume << " " << sum << " " << squares;
+    for (auto b : bins)
+        out << " " << b;
+    out << "\n";
+}
+
+bool analys_state::load(istream &in){
+    in >> volume >> sum >> squares;
+    for (auto &b : bins)
+        in >> b;
+    return (bool)in;
+}
+
+void analys(const vector <int> &array, ostream &out){
+    analys_state state;
+    for (auto v : array)
+        state.add(v);
+    state.report(out);
+}
+
+template <class G>
+void cached_sweep(G puk, const string &dir, const vector <uint64_t> &volumes){
+    for (auto volume : volumes)
+        cached_analys(puk, volume, dir).report(cout);
+}
+
+int run(int argc, char **argv){
+    if (argc > 2){
+        int option = atoi(argv[1]);
+        string dir = argv[2];
+        vector <uint64_t> volumes = {100, 500, 1000, 5000, 10000, 50000, 100000, 500000, 1000000, 5000000};
+
+        if (argc > 3){
+            volumes.clear();
+            for (int i = 3; i < argc; i++)
+                volumes.push_back(strtoull(argv[i], nullptr, 10));
+        }
+        filesystem::create_directories(dir);
+
+        if (option == 1)
+            cached_sweep(generator_1(6089, 0, 10000), dir, volumes);
+        if (option == 2)
+            cached_sweep(generator_2(6089, 0, 10000), dir, volumes);
+        return 0;
+    }
+
+    cout << "Time with C++ random generator\n";
+
+    vector <int> d_100 = {}, d_500 = {}, d_1000 = {}, d_5000 = {}, d_10000 = {}, d_50000 = {}, d_100000 = {}, d_500000 = {}, d_1000000 = {}, d_5000000 = {};
+
+    srand(time(NULL));
+
+    auto s_t = chrono::steady_clock::now();
+    for (long i = 0; i < 100; i++)
+        d_100.push_back(rand());
+    cout << "Generation time for volume of\t100\t" << chrono::duration_cast<std::chrono::microseconds>(chrono::steady_clock::now() - s_t).count() << "\n";
+
+    s_t = chrono::steady_clock::now();
+    for (long i = 0; i < 500; i++)
+        d_500.push_back(rand());
+    cout << "Generation time for volume of\t500\t" << chrono::duration_cast<std::chrono::microseconds>(chrono::steady_clock::now() - s_t).count() << "\n";
+
+    s_t = chrono::steady_clock::now();
+    for (long i = 0; i < 1000; i++)
+        d_1000.push_back(rand());
+    cout << "Generation time for volume of\t1000\t" << chrono::duration_cast<std::chrono::microseconds>(chrono::steady_clock::now() - s_t).count() << "\n";
+
+    s_t = chrono::steady_clock::now();
+    for (long i = 0; i < 5000; i++)
+        d_5000.push_back(rand());
+    cout << "Generation time for volume of\t5000\t" << chrono::duration_cast<std::chrono::microseconds>(chrono::steady_clock::now() - s_t).count() << "\n";
+
+    s_t = chrono::steady_clock::now();
+    for (long i = 0; i < 10000; i++)
+        d_10000.push_back(rand());
+    cout << "Generation time for volume of\t10000\t" << chrono::duration_cast<std::chrono::microseconds>(chrono::steady_clock::now() - s_t).count() << "\n";
+
+    s_t = chrono::steady_clock::now();
+    for (long i = 0; i < 50000; i++)
+        d_50000.push_back(rand());
+    cout << "Generation time for volume of\t50000\t" << chrono::duration_cast<std::chrono::microseconds>(chrono::steady_clock::now() - s_t).count() << "\n";
+
+    s_t = chrono::steady_clock::now();
+    for (long i = 0; i < 100000; i++)
+        d_100000.push_back(rand());
+    cout << "Generation time for volume of\t100000\t" << chrono::duration_cast<std::chrono::microseconds>(chrono::steady_clock::now() - s_t).count() << "\n";
+
+    s_t = chrono::steady_clock::now();
+    for (long i = 0; i < 500000; i++)
+        d_500000.push_back(rand());
+    cout << "Generation time for volume of\t500000\t" << chrono::duration_cast<std::chrono::microseconds>(chrono::steady_clock::now() - s_t).count() << "\n";
+
+    s_t = chrono::steady_clock::now();
+    for (long i = 0; i < 1000000; i++)
+        d_1000000.push_back(rand());
+    cout << "Generation time for volume of\t1000000\t" << chrono::duration_cast<std::chrono::microseconds>(chrono::steady_clock::now() - s_t).count() << "\n";
+
+    s_t = chrono::steady_clock::now();
+    for (long i = 0; i < 5000000; i++)
+        d_5000000.push_back(rand());
+    cout << "Generation time for volume of\t5000000\t"
+         << chrono::duration_cast<std::chrono::microseconds>(chrono::steady_clock::now() - s_t).count()
+         << "\n";
+
+    cout << "\n\n\n";
+
+    int option;
+    cout << "What generator do you want: LCPRNG - print 1, XOR-Shift - print 2, thread pool scaling - print 3\n";
+    if (argc > 1)
+        option = atoi(argv[1]);
+    else
+        cin >> option;
+    cout << endl;
+
+    if (option == 1){
+        generator_1 puk(6089, 0, 10000);
+        ofstream out("output.txt");
+        vector <int> d_100 = {}, d_500 = {}, d_1000 = {}, d_5000 = {}, d_10000 = {}, d_50000 = {}, d_100000 = {}, d_500000 = {}, d_1000000 = {}, d_5000000 = {};
+
+        auto s_t = chrono::steady_clock::now();
+        for (long i = 0; i < 100; i++)
+            d_100.push_back(puk.next());
+        cout << "The time for array with volume 100\t" << chrono::duration_cast<std::chrono::microseconds>(chrono::steady_clock::now() - s_t).count() << "\n";
+
+        s_t = chrono::steady_clock::now();
+        for (long i = 0; i < 500; i++)
+            d_500.push_back(puk.next());
+        cout << "The time for array with volume 500\t" << chrono::duration_cast<std::chrono::microseconds>(chrono::steady_clock::now() - s_t).count() << "\n";
+
+        s_t = chrono::steady_clock::now();
+        for (long i = 0; i < 1000; i++)
+            d_1000.push_back(puk.next());
+        cout << "The time for array with volume 1000\t" << chrono::duration_cast<std::chrono::microseconds>(chrono::steady_clock::now() - s_t).count() << "\n";
+
+        s_t = chrono::steady_clock::now();
+        for (long i = 0; i < 5000; i++)
+            d_5000.push_back(puk.next());
+        cout << "The time for array with volume 5000\t" << chrono::duration_cast<std::chrono::microseconds>(chrono::steady_clock::now() - s_t).count() << "\n";
+
+        s_t = chrono::steady_clock::now();
+        for (long i = 0; i < 10000; i++)
+            d_10000.push_back(puk.next());
+        cout << "The time for array with volume 10000\t" << chrono::duration_cast<std::chrono::microseconds>(chrono::steady_clock::now() - s_t).count() << "\n";
+
+        s_t = chrono::steady_clock::now();
+        for (long i = 0; i < 50000; i++)
+            d_50000.push_back(puk.next());
+        cout << "The time for array with volume 50000\t" << chrono::duration_cast<std::chrono::microseconds>(chrono::steady_clock::now() - s_t).count() << "\n";
+
+        s_t = chrono::steady_clock::now();
+        for (long i = 0; i < 100000; i++)
+            d_100000.push_back(puk.next());
+        cout << "The time for array with volume 100000\t" << chrono::duration_cast<std::chrono::microseconds>(chrono::steady_clock::now() - s_t).count() << "\n";
+
+        s_t = chrono::steady_clock::now();
+        for (long i = 0; i < 500000; i++)
+            d_500000.push_back(puk.next());
+        cout << "The time for array with volume 500000\t" << chrono::duration_cast<std::chrono::microseconds>(chrono::steady_clock::now() - s_t).count() << "\n";
+
+        s_t = chrono::steady_clock::now();
+        for (long i = 0; i < 1000000; i++)
+            d_1000000.push_back(puk.next());
+        cout << "The time for array with volume 1000000\t" << chrono::duration_cast<std::chrono::microseconds>(chrono::steady_clock::now() - s_t).count() << "\n";
+
+        s_t = chrono::steady_clock::now();
+        for (long i = 0; i < 5000000; i++)
+            d_5000000.push_back(puk.next());
+        cout << "The time for array with volume 5000000\t" << chrono::duration_cast<std::chrono::microseconds>(chrono::steady_clock::now() - s_t).count() << "\n";
+
+        analys(d_100);
+        analys(d_500);
+        analys(d_1000);
+        analys(d_5000);
+        analys(d_10000);
+        analys(d_50000);
+        analys(d_100000);
+        analys(d_500000);
+        analys(d_1000000);
+        analys(d_5000000);
+    }
+
+    if (option == 2){
+        generator_2 puk(6089, 0, 10000);
+        ofstream out("output.txt");
+        vector <int> d_100 = {}, d_500 = {}, d_1000 = {}, d_5000 = {}, d_10000 = {}, d_50000 = {}, d_100000 = {}, d_500000 = {}, d_1000000 = {}, d_5000000 = {};
+
+        auto s_t = chrono::steady_clock::now();
+        for (long i = 0; i < 100; i++)
+            d_100.push_back(puk.next());
+        cout << "The time for array with volume 100\t" << chrono::duration_cast<std::chrono::microseconds>(chrono::steady_clock::now() - s_t).count() << "\n";
+
+        s_t = chrono::steady_clock::now();
+        for (long i = 0; i < 500; i++)
+            d_500.push_back(puk.next());
+        cout << "The time for array with volume 500\t" << chrono::duration_cast<std::chrono::microseconds>(chrono::steady_clock::now() - s_t).count() << "\n";
+
+        s_t = chrono::steady_clock::now();
+        for (long i = 0; i < 1000; i++)
+            d_1000.push_back(puk.next());
+        cout << "The time for array with volume 1000\t" << chrono::duration_cast<std::chrono::microseconds>(chrono::steady_clock::now() - s_t).count() << "\n";
+
+        s_t = chrono::steady_clock::now();
+        for (long i = 0; i < 5000; i++)
+            d_5000.push_back(puk.next());
+        cout << "The time for array with volume 5000\t" << chrono::duration_cast<std::chrono::microseconds>(chrono::steady_clock::now() - s_t).count() << "\n";
+
+        s_t = chrono::steady_clock::now();
+        for (long i = 0; i < 10000; i++)
+            d_10000.push_back(puk.next());
+        cout << "The time for array with volume 10000\t" << chrono::duration_cast<std::chrono::microseconds>(chrono::steady_clock::now() - s_t).count() << "\n";
+
+        s_t = chrono::steady_clock::now();
+        for (long i = 0; i < 50000; i++)
+            d_50000.push_back(puk.next());
+        cout << "The time for array with volume 50000\t" << chrono::duration_cast<std::chrono::microseconds>(chrono::steady_clock::now() - s_t).count() << "\n";
+
+        s_t = chrono::steady_clock::now();
+        for (long i = 0; i < 100000; i++)
+            d_100000.push_back(puk.next());
+        cout << "The time for array with volume 100000\t" << chrono::duration_cast<std::chrono::microseconds>(chrono::steady_clock::now() - s_t).count() << "\n";
+
+        s_t = chrono::steady_clock::now();
+        for (long i = 0; i < 500000; i++)
+            d_500000.push_back(puk.next());
+        cout << "The time for array with volume 500000\t" << chrono::duration_cast<std::chrono::microseconds>(chrono::steady_clock::now() - s_t).count() << "\n";
+
+        s_t = chrono::steady_clock::now();
+        for (long i = 0; i < 1000000; i++)
+            d_1000000.push_back(puk.next());
+        cout << "The time for array with volume 1000000\t" << chrono::duration_cast<std::chrono::microseconds>(chrono::steady_clock::now() - s_t).count() << "\n";
+
+        s_t = chrono::steady_clock::now();
+        for (long i = 0; i < 5000000; i++)
+            d_5000000.push_back(puk.next());
+        cout << "The time for array with volume 5000000\t" << chrono::duration_cast<std::chrono::microseconds>(chrono::steady_clock::now() - s_t).count() << "\n";
+
+        analys(d_100);
+        analys(d_500);
+        analys(d_1000);
+        analys(d_5000);
+        analys(d_10000);
+        analys(d_50000);
+        analys(d_100000);
+        analys(d_500000);
+        analys(d_1000000);
+        analys(d_5000000);
+    }
+
+    if (option == 3){
+        cout << "LCPRNG pool, 1000000 numbers per thread\n";
+        pool_scaling<generator_1>();
+        cout << "\nXOR-Shift has no independent streams, so its pool serves only one thread\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,55 @@
+#include "lab4.h"
+
+int main(int argc, char **argv){
+    if (argc < 2){
+        cout << "Usage: lab4_merge <shard files...>\n";
+        return 1;
+    }
+
+    string key, first_key;
+    uint64_t shard, shards = 0;
+    vector <bool> seen;
+    analys_state total;
+
+    for (int i = 1; i < argc; i++){
+        ifstream in(argv[i]);
+        string engine, seed, minV, maxV, volume;
+        uint64_t count;
+        analys_state part;
+
+        if (!(in >> engine >> seed >> minV >> maxV >> volume >> shard >> count) || !part.load(in)){
+            cout << "Cannot read " << argv[i] << "\n";
+            return 1;
+        }
+
+        key = engine + " " + seed + " " + minV + " " + maxV + " " + volume;
+        if (i == 1){
+            first_key = key;
+            shards = count;
+            seen.assign(shards, false);
+        }
+        if (key != first_key || count != shards || shard >= shards){
+            cout << argv[i] << " belongs to another run\n";
+            return 1;
+        }
+        if (seen[shard]){
+            cout << "Shard " << shard << " is given twice\n";
+            return 1;
+        }
+        seen[shard] = true;
+        total.merge(part);
+    }
+
+    bool missing = false;
+    for (uint64_t i = 0; i < shards; i++)
+        if (!seen[i]){
+            cout << "Shard " << i << " of " << shards << " is missing\n";
+            missing = true;
+        }
+    if (missing)
+        return 1;
+
+    cout << first_key << "\n\n";
+    total.report(cout);
+    return 0;
+}
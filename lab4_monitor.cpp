@@ -0,0 +1,76 @@
+#include "lab4_monitor.h"
+
+monitor_core::monitor_core(uint64_t stride_, uint64_t block_, size_t blocks_){
+    if (stride_ == 0 || block_ == 0 || blocks_ == 0)
+        throw invalid_argument("monitor_core: stride, block and blocks must be positive");
+    stride = stride_;
+    block = block_;
+    ring.resize(blocks_);
+}
+
+void monitor_core::sample(int v, uint64_t fingerprint){
+    samples++;
+    current.add(v);
+
+    if (samples == 1)
+        saved = fingerprint;
+    else if (cycle == 0){
+        lam++;
+        if (fingerprint == saved){
+            cycle = lam * stride;
+            publish();
+        }
+        else if (lam == power){
+            saved = fingerprint;
+            power *= 2;
+            lam = 0;
+        }
+    }
+
+    if (current.volume == block){
+        ring[position] = current;
+        position = (position + 1) % ring.size();
+        current = analys_state();
+        publish();
+    }
+}
+
+void monitor_core::publish(){
+    analys_state window;
+    for (auto &b : ring)
+        window.merge(b);
+
+    uint64_t s = sequence.load(memory_order_relaxed);
+    sequence.store(s + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    published[0].store(samples, memory_order_relaxed);
+    published[1].store(cycle, memory_order_relaxed);
+    published[2].store(window.volume, memory_order_relaxed);
+    published[3].store((uint64_t)window.sum, memory_order_relaxed);
+    published[4].store(window.squares, memory_order_relaxed);
+    for (size_t i = 0; i < 10; i++)
+        published[5 + i].store(window.bins[i], memory_order_relaxed);
+
+    sequence.store(s + 2, memory_order_release);
+}
+
+monitor_snapshot monitor_core::snapshot() const {
+    monitor_snapshot result;
+    uint64_t before, after;
+
+    do {
+        before = sequence.load(memory_order_acquire);
+        result.sampled = published[0].load(memory_order_relaxed);
+        result.cycle = published[1].load(memory_order_relaxed);
+        result.window.volume = published[2].load(memory_order_relaxed);
+        result.window.sum = (int64_t)published[3].load(memory_order_relaxed);
+        result.window.squares = published[4].load(memory_order_relaxed);
+        for (size_t i = 0; i < 10; i++)
+            result.window.bins[i] = published[5 + i].load(memory_order_relaxed);
+        atomic_thread_fence(memory_order_acquire);
+        after = sequence.load(memory_order_relaxed);
+    } while ((before & 1) || before != after);
+
+    return result;
+}
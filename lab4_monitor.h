@@ -0,0 +1,210 @@
+#ifndef LAB4_MONITOR_H
+#define LAB4_MONITOR_H
+
+#include "lab4.h"
+
+/**
+ *  @brief Class monitor_snapshot used to return the state of the monitor
+ *  @details Number of samples, statistics of the sliding window of sampled numbers and the length of the found cycle
+ */
+
+class monitor_snapshot{
+public:
+
+    /**
+     *  @brief Class fields
+     *  @details Number of samples taken when the snapshot was published (after every block and when the cycle is found, so next() was
+     *  called at least sampled * stride times), statistics of the window, cycle length in calls of next() or 0 if no cycle was found
+     *  @code
+        uint64_t sampled = 0;
+        analys_state window;
+        uint64_t cycle = 0;
+     *  @endcode
+     */
+
+    uint64_t sampled = 0;
+    analys_state window;
+    uint64_t cycle = 0;
+};
+
+/**
+ *  @brief Class monitor_core used to keep the statistics of the monitor
+ *  @details The samples are collected in blocks, the last blocks form the sliding window with the same statistics as analys.
+ *  The fingerprints of the sampled states go through the cycle search of Brent. The window is published after every block
+ *  with a sequence lock, so snapshot() can be called from any thread and never blocks the generator, while sample() is
+ *  called from one thread only
+ */
+
+class monitor_core{
+public:
+
+    /**
+    *  @brief Parameterized constructor
+    *  @details Used for initialization an object of the class according to the parameters
+    *  @param stride_ parameter with data type uint64_t, block_ parameter with data type uint64_t, blocks_ parameter with data type size_t
+    *  @return There is no return value, invalid_argument is thrown if any parameter is 0
+    */
+
+    monitor_core(uint64_t stride_, uint64_t block_, size_t blocks_);
+
+    /**
+     *  @brief Function for adding the next sample
+     *  @param v parameter with data type int, fingerprint parameter with data type uint64_t, the state of the generator after v
+     *  @return There is no return value
+     */
+
+    void sample(int v, uint64_t fingerprint);
+
+    /**
+     *  @brief Snapshot function
+     *  @details Used for reading the last published state of the monitor, the copy is taken again if a block is published during it
+     *  @param There is no parametrs
+     *  @return The snapshot of the monitor
+     */
+
+    monitor_snapshot snapshot() const;
+
+private:
+    uint64_t stride, block;
+    uint64_t samples = 0;
+    analys_state current;
+    vector <analys_state> ring;
+    size_t position = 0;
+
+    uint64_t saved = 0;
+    uint64_t power = 1;
+    uint64_t lam = 0;
+    uint64_t cycle = 0;
+
+    alignas(64) atomic<uint64_t> sequence{0};
+    atomic<uint64_t> published[15] = {};
+
+    void publish();
+};
+
+/**
+ *  @brief Class monitored used to watch the quality of a generator while it works
+ *  @details Every stride-th number of next() is given to the monitor_core together with the state of the generator. The state is the
+ *  full fingerprint of the generator, so a found cycle is never false. The sampled sequence repeats with the period of the generator
+ *  divided by its greatest common divisor with stride, so the found length is a multiple of the true period.
+ *  The monitor_core is kept apart from the generator, so between the samples next() costs one more decrement and comparison.
+ *  One sample costs about as much as two numbers, so the default stride 1024 keeps it far below 1% of the time of the generator.
+ *  fill() takes many numbers at once without the comparison for every number
+ */
+
+template <class G>
+class monitored{
+public:
+
+    /**
+     *  @brief Class fields
+     *  @details The watched generator, distance between the samples
+     *  @code
+        G gen;
+        uint64_t stride;
+     *  @endcode
+     */
+
+    G gen;
+    uint64_t stride;
+
+    /**
+    *  @brief Parameterized constructor
+    *  @details Used for initialization an object of the class according to the parameters
+    *  @param gen_ parameter with data type G, stride_ parameter with data type uint64_t, block parameter with data type uint64_t (samples in one block), blocks parameter with data type size_t (blocks in the window)
+    *  @return There is no return value, invalid_argument is thrown if stride_, block or blocks is 0
+    */
+
+    monitored(G gen_, uint64_t stride_ = 1024, uint64_t block = 1024, size_t blocks = 16) : gen(gen_), stride(stride_), core(new monitor_core(stride_, block, blocks)){
+        countdown = stride;
+    }
+
+    /**
+     *  @brief Search function for the next random number
+     *  @details Used for taking the next number of the generator, every stride-th number is sampled
+     *  @param There is no parametrs
+     *  @return The next element
+     *  @code
+        int next() {
+            int v = gen.next();
+            if (--countdown == 0){
+                countdown = stride;
+                core->sample(v, gen.start);
+            }
+            return v;
+        }
+     *  @endcode
+     */
+
+    int next() {
+        int v = gen.next();
+        if (--countdown == 0){
+            countdown = stride;
+            core->sample(v, gen.start);
+        }
+        return v;
+    }
+
+    /**
+     *  @brief Function for taking many numbers at once
+     *  @details Gives the same numbers and samples as n calls of next(), but the numbers between the samples are taken in a loop without
+     *  the countdown
+     *  @param out parameter with data type of output iterator, n parameter with data type uint64_t
+     *  @return The output iterator after the last written number
+     *  @code
+        template <class Out>
+        Out fill(Out out, uint64_t n) {
+            while (n >= countdown){
+                for (uint64_t i = 1; i < countdown; i++)
+                    *out++ = gen.next();
+                int v = gen.next();
+                *out++ = v;
+                core->sample(v, gen.start);
+                n -= countdown;
+                countdown = stride;
+            }
+            for (; n > 0; n--, countdown--)
+                *out++ = gen.next();
+            return out;
+        }
+     *  @endcode
+     */
+
+    template <class Out>
+    Out fill(Out out, uint64_t n) {
+        while (n >= countdown){
+            for (uint64_t i = 1; i < countdown; i++)
+                *out++ = gen.next();
+            int v = gen.next();
+            *out++ = v;
+            core->sample(v, gen.start);
+            n -= countdown;
+            countdown = stride;
+        }
+        for (; n > 0; n--, countdown--)
+            *out++ = gen.next();
+        return out;
+    }
+
+    /**
+     *  @brief Snapshot function
+     *  @details Can be called from any thread
+     *  @param There is no parametrs
+     *  @return The snapshot of the monitor
+     *  @code
+        monitor_snapshot snapshot() const {
+            return core->snapshot();
+        }
+     *  @endcode
+     */
+
+    monitor_snapshot snapshot() const {
+        return core->snapshot();
+    }
+
+private:
+    uint64_t countdown;
+    unique_ptr<monitor_core> core;
+};
+
+#endif
@@ -0,0 +1,55 @@
+#include "lab4.h"
+
+template <class G>
+int shard_analys(G gen, uint64_t volume, uint64_t shard, uint64_t shards, const string &file){
+    if (G::period == 0 && shards > 1){
+        cout << "This generator has no jump-ahead, its sequence cannot be split into shards\n";
+        return 1;
+    }
+    if (G::period != 0 && volume > G::period)
+        cout << "Warning: the volume is bigger than the period " << G::period << ", the sequence repeats\n";
+
+    uint64_t first = shard * (volume / shards) + min(shard, volume % shards);
+    uint64_t count = volume / shards + (shard < volume % shards);
+    analys_state state;
+
+    G puk = make_shard(gen, shard, first);
+    for (uint64_t i = 0; i < count; i++)
+        state.add(puk.next());
+
+    ofstream out(file);
+    out << engine_key(gen) << " " << gen.start << " " << gen.minV << " " << gen.maxV << " " << volume << " " << shard << " " << shards << "\n";
+    state.save(out);
+    out.close();
+    if (!out){
+        cout << "Cannot write " << file << "\n";
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char **argv){
+    if (argc != 6){
+        cout << "Usage: lab4_shard <generator: 1 - LCPRNG, 2 - XOR-Shift> <total volume> <shard> <number of shards> <output file>\n";
+        cout << "XOR-Shift has no jump-ahead, so it can be run only as one shard\n";
+        return 1;
+    }
+
+    int option = atoi(argv[1]);
+    uint64_t volume = strtoull(argv[2], nullptr, 10);
+    uint64_t shard = strtoull(argv[3], nullptr, 10);
+    uint64_t shards = strtoull(argv[4], nullptr, 10);
+
+    if (shards == 0 || shard >= shards){
+        cout << "The shard must be less than the number of shards\n";
+        return 1;
+    }
+
+    if (option == 1)
+        return shard_analys(generator_1(6089, 0, 10000), volume, shard, shards, argv[5]);
+    if (option == 2)
+        return shard_analys(generator_2(6089, 0, 10000), volume, shard, shards, argv[5]);
+
+    cout << "Unknown generator " << argv[1] << "\n";
+    return 1;
+}
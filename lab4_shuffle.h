@@ -0,0 +1,284 @@
+#ifndef LAB4_SHUFFLE_H
+#define LAB4_SHUFFLE_H
+
+#include "lab4.h"
+#include <iterator>
+
+/**
+ *  @brief Function for the unbiased random index
+ *  @details Used instead of next() % n, which gives small numbers more often. For raw_range 2^32 it uses the multiply and shift
+ *  method of Lemire, otherwise the raw numbers above the last full multiple of n are rejected
+ *  @param gen parameter with data type G, n parameter with data type uint64_t, n must be less than G::raw_range
+ *  @return The number from 0 to n - 1
+ */
+
+template <class G>
+inline uint64_t uniform_index(G &gen, uint64_t n){
+    if constexpr (G::raw_range == (uint64_t(1) << 32)){
+        uint64_t m = gen.raw() * n;
+        if ((uint32_t)m < n){
+            uint32_t limit = (uint32_t)(-(uint32_t)n) % (uint32_t)n;
+            while ((uint32_t)m < limit)
+                m = gen.raw() * n;
+        }
+        return m >> 32;
+    }
+
+    uint64_t limit = G::raw_range - G::raw_range % n, r = gen.raw();
+    while (r >= limit)
+        r = gen.raw();
+    return r % n;
+}
+
+/**
+ *  @brief Function for the random number between 0 and 1
+ *  @param gen parameter with data type G
+ *  @return The number from the open interval (0, 1)
+ */
+
+template <class G>
+inline double uniform_real(G &gen){
+    return (gen.raw() + 0.5) / G::raw_range;
+}
+
+/**
+ *  @brief Function for the geometric gap
+ *  @param gen parameter with data type G, scale parameter with data type double, equal to 1 / log(1 - p)
+ *  @return The number of failures before the first success of the Bernoulli trials with probability p
+ */
+
+template <class G>
+inline uint64_t geometric_skip(G &gen, double scale){
+    double skip = floor(log(uniform_real(gen)) * scale);
+    return skip < 1e18 ? (uint64_t)skip : (uint64_t)1e18;
+}
+
+/**
+ *  @brief Class engine_bits used to pass the generators to the standard algorithms
+ *  @details Makes a UniformRandomBitGenerator from the raw numbers of the generator, for example for std::shuffle
+ */
+
+template <class G>
+class engine_bits{
+public:
+    using result_type = uint64_t;
+
+    G &gen;
+
+    engine_bits(G &gen_) : gen(gen_){
+    }
+
+    static constexpr result_type min() {
+        return 0;
+    }
+
+    static constexpr result_type max() {
+        return G::raw_range - 1;
+    }
+
+    result_type operator()() {
+        return gen.raw();
+    }
+};
+
+/**
+ *  @brief Fisher-Yates shuffle
+ *  @details The random indices are made in blocks of 64 and the elements they point to are prefetched before the swaps,
+ *  so the cache misses of a big array overlap instead of going one after another
+ *  @param first, last parameters with data type of random access iterator, gen parameter with data type G
+ *  @return There is no return value
+ */
+
+template <class It, class G>
+void fisher_yates(It first, It last, G &gen){
+    const uint64_t block = 64;
+    uint64_t index[block];
+    uint64_t i = last - first;
+
+    while (i > 1){
+        uint64_t count = min(block, i - 1);
+        for (uint64_t k = 0; k < count; k++){
+            index[k] = uniform_index(gen, i - k);
+#if defined(__GNUC__)
+            __builtin_prefetch(&*(first + index[k]), 1);
+#endif
+        }
+        for (uint64_t k = 0; k < count; k++)
+            iter_swap(first + (i - k - 1), first + index[k]);
+        i -= count;
+    }
+}
+
+/**
+ *  @brief Merge function of MergeShuffle
+ *  @details Used for joining two shuffled neighbouring parts into one shuffled part (Bacher, Bodini, Hollender, Lumbroso)
+ *  @param first, middle, last parameters with data type of random access iterator, gen parameter with data type G
+ *  @return There is no return value
+ */
+
+template <class It, class G>
+void merge_shuffled(It first, It middle, It last, G &gen){
+    It u = first, v = middle;
+
+    while (true){
+        if (uniform_index(gen, 2)){
+            if (v == last)
+                break;
+            iter_swap(u, v);
+            ++v;
+        }
+        else if (u == v)
+            break;
+        ++u;
+    }
+
+    for (; u != last; ++u)
+        iter_swap(first + uniform_index(gen, (u - first) + 1), u);
+}
+
+/**
+ *  @brief Budget of random numbers for one task of parallel_shuffle
+ *  @details fisher_yates and merge_shuffled over n elements take at most n + 1 numbers plus the rejected ones of uniform_index.
+ *  For n up to 2^29 less than n / 32 numbers are rejected on average, so n / 16 more is left for them
+ *  @param n parameter with data type uint64_t
+ *  @return The number of random numbers kept for the task
+ */
+
+inline uint64_t shuffle_budget(uint64_t n){
+    return n + n / 16 + 64;
+}
+
+/**
+ *  @brief Parallel shuffle
+ *  @details The array is split into a power of two parts that are shuffled with fisher_yates on their own threads, then the neighbouring
+ *  parts are joined with merge_shuffled, also in parallel. Every task starts where the budget of the previous one ends, so the tasks
+ *  take disjoint segments of the sequence. The number of parts is halved until all the segments fit into the period of the generator,
+ *  and gen is moved past all of them at the end. The generators without jump-ahead (G::period is 0) are shuffled with fisher_yates
+ *  on one thread
+ *  @param first, last parameters with data type of random access iterator, gen parameter with data type G, threads parameter with data type unsigned
+ *  @return There is no return value
+ */
+
+template <class It, class G>
+void parallel_shuffle(It first, It last, G &gen, unsigned threads = thread::hardware_concurrency()){
+    if constexpr (G::period == 0)
+        fisher_yates(first, last, gen);
+    else {
+        uint64_t n = last - first, parts = 1, total = 0;
+        while (parts * 2 <= threads && parts * 2 * 4096 <= n)
+            parts *= 2;
+
+        vector <uint64_t> bounds, offsets;
+        for (; parts > 1; parts /= 2){
+            bounds.clear();
+            for (uint64_t k = 0; k <= parts; k++)
+                bounds.push_back(n * k / parts);
+
+            offsets.clear();
+            total = 0;
+            for (uint64_t k = 0; k < parts; k++){
+                offsets.push_back(total);
+                total += shuffle_budget(bounds[k + 1] - bounds[k]);
+            }
+            for (uint64_t width = 1; width < parts; width *= 2)
+                for (uint64_t k = 0; k < parts; k += 2 * width){
+                    offsets.push_back(total);
+                    total += shuffle_budget(bounds[k + 2 * width] - bounds[k]);
+                }
+
+            if (total <= G::period)
+                break;
+        }
+
+        if (parts == 1){
+            fisher_yates(first, last, gen);
+            return;
+        }
+
+        uint64_t task = 0;
+        vector <thread> workers;
+        for (uint64_t k = 0; k < parts; k++, task++)
+            workers.emplace_back([=]{
+                G puk = gen;
+                puk.jump(offsets[task]);
+                fisher_yates(first + bounds[k], first + bounds[k + 1], puk);
+            });
+        for (auto &w : workers)
+            w.join();
+
+        for (uint64_t width = 1; width < parts; width *= 2){
+            workers.clear();
+            for (uint64_t k = 0; k < parts; k += 2 * width, task++)
+                workers.emplace_back([=]{
+                    G puk = gen;
+                    puk.jump(offsets[task]);
+                    merge_shuffled(first + bounds[k], first + bounds[k + width], first + bounds[k + 2 * width], puk);
+                });
+            for (auto &w : workers)
+                w.join();
+        }
+
+        gen.jump(total);
+    }
+}
+
+/**
+ *  @brief Reservoir sampling
+ *  @details Used for choosing k elements of a stream of unknown length with equal probability. Algorithm L is used,
+ *  so the random numbers are needed only for the elements that get into the reservoir
+ *  @param first, last parameters with data type of input iterator, k parameter with data type size_t, gen parameter with data type G
+ *  @return The vector of the chosen elements, all elements if there are fewer than k
+ */
+
+template <class It, class G>
+vector <typename iterator_traits<It>::value_type> reservoir_sample(It first, It last, size_t k, G &gen){
+    vector <typename iterator_traits<It>::value_type> sample;
+
+    for (; first != last && sample.size() < k; ++first)
+        sample.push_back(*first);
+    if (first == last || k == 0)
+        return sample;
+
+    double w = exp(log(uniform_real(gen)) / k);
+    while (true){
+        uint64_t skip = geometric_skip(gen, 1 / log1p(-w));
+        for (uint64_t s = 0; s < skip && first != last; s++)
+            ++first;
+        if (first == last)
+            break;
+        sample[uniform_index(gen, k)] = *first;
+        ++first;
+        w *= exp(log(uniform_real(gen)) / k);
+    }
+    return sample;
+}
+
+/**
+ *  @brief Bernoulli sampling
+ *  @details Used for taking every element of the stream with probability p. The gaps between the taken elements are drawn from
+ *  the geometric distribution, so there is one random number per taken element instead of one per element
+ *  @param first, last parameters with data type of input iterator, p parameter with data type double, gen parameter with data type G, out parameter with data type of output iterator
+ *  @return The output iterator after the last written element
+ */
+
+template <class It, class Out, class G>
+Out bernoulli_sample(It first, It last, double p, G &gen, Out out){
+    if (p <= 0)
+        return out;
+    if (p >= 1)
+        return copy(first, last, out);
+
+    double scale = 1 / log1p(-p);
+    while (true){
+        uint64_t skip = geometric_skip(gen, scale);
+        for (uint64_t s = 0; s < skip && first != last; s++)
+            ++first;
+        if (first == last)
+            break;
+        *out++ = *first;
+        ++first;
+    }
+    return out;
+}
+
+#endif
@@ -0,0 +1,64 @@
+#!/bin/sh
+# Builds the release, LTO and PGO (LTO + profile) variants, trains the PGO
+# build on the standard volume sweep and prints the benchmarks side by side.
+# Every cell of lab4_bench is already the median of 7 runs; the three
+# variants are then run in turn RUNS times and the fastest run of each cell
+# is reported, so a slow moment of the machine hits all variants alike.
+# The instrumented and the optimized PGO builds share build/pgo, so the
+# profile file names match between the two stages.
+set -e
+cd "$(dirname "$0")"
+
+for preset in release lto; do
+    cmake --preset $preset > /dev/null
+    cmake --build build/$preset
+done
+
+rm -rf build/pgo-profile
+rm -f build/*/bench*.txt
+cmake --preset pgo-generate > /dev/null
+cmake --build build/pgo --clean-first
+(cd build/pgo && ./lab4 1 > /dev/null && ./lab4 2 > /dev/null && ./lab4_bench > /dev/null)
+
+if ls build/pgo-profile/*.profraw > /dev/null 2>&1; then
+    llvm-profdata merge -o build/pgo-profile/default.profdata build/pgo-profile/*.profraw
+fi
+
+cmake --preset pgo > /dev/null
+cmake --build build/pgo --clean-first
+
+RUNS=${RUNS:-5}
+run=1
+while [ $run -le $RUNS ]; do
+    for preset in release lto pgo; do
+        build/$preset/lab4_bench > build/$preset/bench$run.txt
+    done
+    run=$((run + 1))
+done
+
+for preset in release lto pgo; do
+    paste build/$preset/bench[0-9]*.txt | awk -F '\t' '
+        NR == 1 {
+            printf "%s\t%s\t%s\t%s\n", $1, $2, $3, $4
+            next
+        }
+        {
+            gen = $3
+            analys = $4
+            for (i = 5; i <= NF; i += 4) {
+                if ($(i + 2) < gen) gen = $(i + 2)
+                if ($(i + 3) < analys) analys = $(i + 3)
+            }
+            printf "%s\t%s\t%.3f\t%.3f\n", $1, $2, gen, analys
+        }' > build/$preset/bench.txt
+done
+
+paste build/release/bench.txt build/lto/bench.txt build/pgo/bench.txt | awk -F '\t' '
+    NR == 1 {
+        printf "%-10s %8s | %28s | %28s\n", "", "", "ns/number", "analys ns/number"
+        printf "%-10s %8s | %8s %9s %9s | %8s %9s %9s\n", "Generator", "Volume", "release", "lto", "pgo", "release", "lto", "pgo"
+        next
+    }
+    {
+        printf "%-10s %8s | %8s %9s %9s | %8s %9s %9s\n", $1, $2, $3, $7, $11, $4, $8, $12
+    }' | tee build/pgo_report.txt
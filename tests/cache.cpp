@@ -0,0 +1,76 @@
+#include "check.h"
+#include <filesystem>
+
+/**
+ *  @brief Function for the statistics without the cache
+ *  @param volume parameter with data type uint64_t
+ *  @return The analys_state of the first volume numbers of generator_1 with the initial value 6089
+ */
+
+analys_state direct(uint64_t volume){
+    generator_1 gen(6089, 0, 10000);
+    analys_state state;
+    for (uint64_t i = 0; i < volume; i++)
+        state.add(gen.next());
+    return state;
+}
+
+/**
+ *  @brief Function for reading the lines of the cache file
+ *  @param file parameter with data type string
+ *  @return The lines of the file, the last one without the end of line if it has none
+ */
+
+vector <string> lines_of(const string &file){
+    ifstream in(file);
+    vector <string> lines;
+    string line;
+    while (getline(in, line))
+        lines.push_back(line);
+    return lines;
+}
+
+int main(int argc, char **argv){
+    string dir = argc > 1 ? argv[1] : "cache_test";
+    filesystem::remove_all(dir);
+    filesystem::create_directories(dir);
+
+    generator_1 gen(6089, 0, 10000);
+    string file = dir + "/" + engine_key(gen) + "_6089_0_10000.txt";
+
+    check(cached_analys(gen, 50000, dir) == direct(50000), "first run");
+    vector <string> good = lines_of(file);
+    check(good.size() == 1, "one checkpoint after the first run");
+
+    {
+        ofstream out(file, ios::app);
+        out << "garbage line\n";
+        out << good[0] << " 7\n";
+        out << good[0].substr(0, good[0].size() - 2);
+    }
+    generator_1 again(6089, 0, 10000);
+    check(cached_analys(again, 50000, dir) == direct(50000), "truncated last line is skipped");
+
+    generator_1 longer(6089, 0, 10000);
+    check(cached_analys(longer, 100000, dir) == direct(100000), "checkpoint after the broken lines");
+    generator_1 tail(6089, 0, 10000);
+    for (int i = 0; i < 100000; i++)
+        tail.next();
+    check(longer.start == tail.start, "generator is moved to the end of the sequence");
+
+    vector <string> rewritten = lines_of(file);
+    check(rewritten.size() == 2 && rewritten[0] == good[0], "broken lines are dropped when the file is rewritten");
+
+    generator_1 later(6089, 0, 10000);
+    check(cached_analys(later, 100000, dir) == direct(100000), "rewritten file is read back");
+    check(lines_of(file).size() == 2, "nothing is written for a cached volume");
+
+    size_t files = 0;
+    for (auto &entry : filesystem::directory_iterator(dir))
+        files += entry.is_regular_file();
+    check(files == 1, "no temporary files are left");
+
+    if (failures == 0)
+        cout << "Cache checks passed\n";
+    return failures == 0 ? 0 : 1;
+}
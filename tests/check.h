@@ -0,0 +1,26 @@
+#ifndef LAB4_CHECK_H
+#define LAB4_CHECK_H
+
+#include "lab4.h"
+
+/**
+ *  @brief Number of failed checks of the test
+ */
+
+inline int failures = 0;
+
+/**
+ *  @brief Check function
+ *  @details Used for printing the failed check and counting it
+ *  @param ok parameter with data type bool, what parameter with data type string
+ *  @return There is no return value
+ */
+
+inline void check(bool ok, const string &what){
+    if (!ok){
+        cout << "FAILED: " << what << "\n";
+        failures++;
+    }
+}
+
+#endif
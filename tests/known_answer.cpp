@@ -0,0 +1,182 @@
+#include "check.h"
+
+/**
+ *  @brief Known-answer check function
+ *  @details Used for comparing the first numbers of the generator with the golden sequence at compile time
+ *  @param gen parameter with data type G, expected parameter with data type array of int
+ *  @return True if the generator gives exactly the expected numbers
+ */
+
+template <class G, size_t N>
+constexpr bool known_answer(G gen, const int (&expected)[N]){
+    for (size_t i = 0; i < N; i++)
+        if (gen.next() != expected[i])
+            return false;
+    return true;
+}
+
+/**
+ *  @brief Golden sequences of the generators
+ *  @details Known answers for several initial values and ranges, recorded from the original 64-bit build. The test does not compile if any sequence changes
+ */
+
+static_assert(known_answer(generator_1(1, 0, 10000), {9972, 3929, 348, 9137, 1796, 7449, 588, 1233, 4164, 6249, 4060, 321, 5188, 5721, 5276, 7361}), "generator_1 1 0..10000");
+static_assert(known_answer(generator_2(1, 0, 10000), {4321, 7721, 3067, 7712, 9926, 9580, 8404, 2413, 803, 5905, 6404, 115, 290, 3173, 8378, 8069}), "generator_2 1 0..10000");
+static_assert(known_answer(generator_1(1, -500, 500), {472, 429, -152, -363, 296, -51, 88, -267, -336, -251, -440, -179, -312, 221, -224, -139}), "generator_1 1 -500..500");
+static_assert(known_answer(generator_2(1, -500, 500), {-179, 221, -433, 212, 426, 80, -96, -87, 303, 405, -96, -385, -210, -327, -122, -431}), "generator_2 1 -500..500");
+static_assert(known_answer(generator_1(1, 0, 2), {0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1}), "generator_1 1 0..2");
+static_assert(known_answer(generator_2(1, 0, 2), {1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 0, 1, 0, 1, 0, 1}), "generator_2 1 0..2");
+static_assert(known_answer(generator_1(6089, 0, 10000), {6780, 8673, 3908, 1257, 6556, 353, 8084, 9529, 5836, 6097, 1412, 8777, 3836, 4913, 8996, 2169}), "generator_1 6089 0..10000");
+static_assert(known_answer(generator_2(6089, 0, 10000), {7675, 4169, 3356, 4027, 2819, 7555, 5898, 7859, 410, 6281, 3451, 7655, 3429, 6145, 6635, 826}), "generator_2 6089 0..10000");
+static_assert(known_answer(generator_1(6089, -500, 500), {280, 173, 408, -243, 56, -147, -416, 29, 336, -403, -88, 277, 336, 413, 496, -331}), "generator_1 6089 -500..500");
+static_assert(known_answer(generator_2(6089, -500, 500), {175, -331, -144, -473, 319, 55, 398, 359, -90, -219, -49, 155, -71, -355, 135, 326}), "generator_2 6089 -500..500");
+static_assert(known_answer(generator_1(6089, 0, 2), {0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1}), "generator_1 6089 0..2");
+static_assert(known_answer(generator_2(6089, 0, 2), {1, 1, 0, 1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 1, 0}), "generator_2 6089 0..2");
+static_assert(known_answer(generator_1(4294967295, 0, 10000), {6, 4887, 3294, 4335, 198, 7143, 6862, 6255, 5974, 5047, 606, 7695, 3238, 5063, 5070, 383}), "generator_1 4294967295 0..10000");
+static_assert(known_answer(generator_2(4294967295, 0, 10000), {5804, 6973, 5667, 4167, 834, 2525, 1180, 749, 8533, 4880, 6516, 2496, 323, 4257, 264, 415}), "generator_2 4294967295 0..10000");
+static_assert(known_answer(generator_1(4294967295, -500, 500), {-494, 387, -206, -165, -302, -357, 362, -245, 474, -453, 106, 195, -262, -437, -430, -117}), "generator_1 4294967295 -500..500");
+static_assert(known_answer(generator_2(4294967295, -500, 500), {304, 473, 167, -333, 334, 25, -320, 249, 33, 380, 16, -4, -177, -243, -236, -85}), "generator_2 4294967295 -500..500");
+static_assert(known_answer(generator_1(4294967295, 0, 2), {0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1}), "generator_1 4294967295 0..2");
+static_assert(known_answer(generator_2(4294967295, 0, 2), {0, 1, 1, 1, 0, 1, 0, 1, 1, 0, 0, 0, 1, 1, 0, 1}), "generator_2 4294967295 0..2");
+static_assert(known_answer(generator_1(123456789012, 0, 10000), {2617, 2940, 4449, 1236, 6089, 2876, 8609, 5332, 2777, 6876, 6977, 4644, 3209, 4156, 1, 3716}), "generator_1 123456789012 0..10000");
+static_assert(known_answer(generator_2(123456789012, 0, 10000), {7355, 3575, 5626, 7301, 4805, 3292, 8844, 601, 739, 4429, 6203, 4509, 1490, 7671, 3200, 5972}), "generator_2 123456789012 0..10000");
+static_assert(known_answer(generator_1(123456789012, -500, 500), {117, 440, -51, -264, -411, 376, 109, -168, 277, 376, 477, 144, -291, -344, -499, 216}), "generator_1 123456789012 -500..500");
+static_assert(known_answer(generator_2(123456789012, -500, 500), {-145, 75, 126, -199, 305, -208, 344, 101, 239, -71, -297, 9, -10, 171, -300, 472}), "generator_2 123456789012 -500..500");
+static_assert(known_answer(generator_1(123456789012, 0, 2), {1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0}), "generator_1 123456789012 0..2");
+static_assert(known_answer(generator_2(123456789012, 0, 2), {1, 1, 0, 1, 1, 0, 0, 1, 1, 1, 1, 1, 0, 1, 0, 0}), "generator_2 123456789012 0..2");
+static_assert(known_answer(make_stream(generator_1(6089, 0, 10000), 1), {636, 2081, 5940, 9193}), "generator_1 stream 1");
+static_assert(known_answer(make_stream(generator_2(6089, 0, 10000), 1), {6555, 8124, 2877, 6370, 1727, 2985, 48, 8264, 541, 3116, 2736, 8357, 5709, 1537, 4223, 930}), "generator_2 stream 1");
+static_assert(known_answer(make_stream(generator_2(6089, 0, 10000), 63), {8808, 7765, 3675, 9700, 8521, 5619, 4570, 9210, 4048, 5706, 8850, 9514, 4232, 587, 4776, 5062}), "generator_2 stream 63");
+static_assert(make_table<4>(generator_1(6089, 0, 10000))[3] == 1257, "make_table");
+
+/**
+ *  @brief Class horizon used to keep the golden state after many numbers
+ *  @details Recorded from the original 64-bit build by calling next() steps times
+ */
+
+class horizon{
+public:
+    uint64_t seed;
+    uint64_t steps;
+    uint64_t start_1;
+    int next_1[4];
+    uint64_t start_2;
+    int next_2[4];
+};
+
+const horizon horizons[] = {
+    {1, 1000000, 2303182081, {4, 3625, 7276, 8801}, 1725746204, {698, 9192, 8144, 6154}},
+    {1, 16777216, 1946157057, {2948, 5513, 4204, 2545}, 2839002820, {5715, 6651, 3554, 9025}},
+    {6089, 1000000, 551496905, {7372, 7393, 2916, 4361}, 4170943987, {6544, 8410, 3846, 8993}},
+    {6089, 16777216, 3019904969, {636, 2081, 5940, 9193}, 4745624604, {4635, 343, 4005, 6272}},
+    {4294967295, 1000000, 168972543, {8630, 6679, 8286, 3807}, 2618411768, {492, 7420, 584, 3876}},
+    {4294967295, 16777216, 603979775, {6614, 6487, 782, 7759}, 3496543212, {4853, 3727, 1485, 6076}},
+    {123456789012, 1000000, 3779112212, {9897, 2412, 4049, 6324}, 7171927634, {2348, 5465, 9142, 4251}},
+    {123456789012, 16777216, 2862160404, {4201, 6796, 7857, 3268}, 5029056611, {8421, 8254, 2948, 8198}},
+};
+
+/**
+ *  @brief Function for checking the long sequences
+ *  @details Used for comparing jump(n) with n calls of raw() and both with the golden states after 10^6 and 2^24 numbers
+ *  @param There is no parameters
+ *  @return There is no return value
+ */
+
+void long_horizon(){
+    const uint64_t seeds[] = {1, 6089, 4294967295, 123456789012};
+    const uint64_t checkpoints[] = {1, 1000, 1000000, uint64_t(1) << 24};
+
+    for (uint64_t seed : seeds){
+        generator_1 walk_1(seed, 0, 10000);
+        generator_2 walk_2(seed, 0, 10000);
+        uint64_t done = 0;
+
+        for (uint64_t steps : checkpoints){
+            for (; done < steps; done++){
+                walk_1.raw();
+                walk_2.raw();
+            }
+            string name = to_string(seed) + " after " + to_string(steps);
+
+            generator_1 jumped(seed, 0, 10000);
+            jumped.jump(steps);
+            check(jumped.start == walk_1.start, "generator_1 jump " + name);
+
+            for (const horizon &h : horizons)
+                if (h.seed == seed && h.steps == steps){
+                    check(walk_1.start == h.start_1, "generator_1 state " + name);
+                    check(walk_2.start == h.start_2, "generator_2 state " + name);
+                    generator_1 next_1 = walk_1;
+                    generator_2 next_2 = walk_2;
+                    for (int i = 0; i < 4; i++){
+                        check(next_1.next() == h.next_1[i], "generator_1 numbers " + name);
+                        check(next_2.next() == h.next_2[i], "generator_2 numbers " + name);
+                    }
+                }
+        }
+
+        generator_1 full(seed, 0, 10000);
+        full.jump(generator_1::period);
+        check(full.start == (uint32_t)seed, "generator_1 period " + to_string(seed));
+        full.jump(generator_1::period / 2);
+        check(full.start != (uint32_t)seed, "generator_1 half period " + to_string(seed));
+    }
+
+    generator_1 far(6089, 0, 10000);
+    far.jump(uint64_t(1) << 26);
+    check(far.start == 3489667017, "generator_1 6089 after 2^26");
+    far.jump(generator_1::period * 3);
+    check(far.start == 3489667017, "generator_1 6089 after 3 periods and 2^26");
+}
+
+/**
+ *  @brief Function for checking the streams and the shards
+ *  @details The stream k of generator_1 must start k * stream_stride numbers later, stream 64 is stream 0 again.
+ *  The shards of an uneven split together must give exactly the sequence of one generator
+ *  @param There is no parameters
+ *  @return There is no return value
+ */
+
+void streams_and_shards(){
+    generator_1 gen(6089, 0, 10000);
+
+    for (uint64_t k = 0; k < stream_limit<generator_1>(); k++){
+        generator_1 jumped = gen;
+        jumped.jump(k * stream_stride);
+        check(make_stream(gen, k).start == jumped.start, "generator_1 stream " + to_string(k));
+    }
+    check(stream_limit<generator_1>() == 64, "generator_1 stream limit");
+    check(make_stream(gen, 64).start == gen.start, "generator_1 stream 64 wraps to stream 0");
+    check(stream_limit<generator_2>() == 1, "generator_2 stream limit");
+
+    const uint64_t volume = 1000003, shards = 7;
+    vector <int> whole;
+    generator_1 one = gen;
+    for (uint64_t i = 0; i < volume; i++)
+        whole.push_back(one.next());
+
+    for (uint64_t shard = 0; shard < shards; shard++){
+        uint64_t first = shard * (volume / shards) + min(shard, volume % shards);
+        uint64_t count = volume / shards + (shard < volume % shards);
+        generator_1 part = make_shard(gen, shard, first);
+        bool same = true;
+        for (uint64_t i = 0; i < count; i++)
+            same = same && part.next() == whole[first + i];
+        check(same, "generator_1 shard " + to_string(shard) + " of " + to_string(shards));
+    }
+
+    generator_1 late = make_shard(gen, 0, (uint64_t(1) << 24) + 1000000);
+    generator_1 walk = make_stream(gen, 1);
+    for (int i = 0; i < 1000000; i++)
+        walk.raw();
+    check(late.start == walk.start, "generator_1 shard at 2^24 + 10^6");
+}
+
+int main(){
+    long_horizon();
+    streams_and_shards();
+
+    if (failures == 0)
+        cout << "All known answers match\n";
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,160 @@
+#include "lab4_monitor.h"
+#include "check.h"
+
+/**
+ *  @brief Function for checking the cycle search
+ *  @details XOR-Shift from 6089 comes into a cycle of 13896 numbers after 30858 numbers, with stride 64 the sampled states repeat after lcm(13896, 64) = 111168,
+ *  with stride 1024 after 1778688.
+ *  generator_1 has the period 2^30, so no cycle may be found in 2 * 10^6 numbers
+ *  @param There is no parameters
+ *  @return There is no return value
+ */
+
+void cycles(){
+    generator_2 brute(6089, 0, 10000);
+    for (int i = 0; i < 100000; i++)
+        brute.raw();
+    uint64_t period = 0, first = brute.raw();
+    do
+        period++;
+    while (brute.raw() != first);
+    check(period == 13896, "generator_2 6089 period by brute force");
+
+    for (uint64_t stride : {1, 64}){
+        monitored<generator_2> watched(generator_2(6089, 0, 10000), stride);
+        for (int i = 0; i < 2000000; i++)
+            watched.next();
+        uint64_t expected = stride == 1 ? 13896 : 111168;
+        check(watched.snapshot().cycle == expected, "generator_2 cycle with stride " + to_string(stride));
+    }
+
+    monitored<generator_2> bulk(generator_2(6089, 0, 10000));
+    vector <int> buffer(1000000);
+    for (int i = 0; i < 12; i++)
+        bulk.fill(buffer.begin(), buffer.size());
+    check(bulk.snapshot().cycle == 1778688, "generator_2 cycle with the default stride 1024 through fill()");
+
+    monitored<generator_1> lcg(generator_1(6089, 0, 10000), 1);
+    for (int i = 0; i < 2000000; i++)
+        lcg.next();
+    check(lcg.snapshot().cycle == 0, "no false cycle of generator_1");
+}
+
+/**
+ *  @brief Function for checking the window
+ *  @details After 10 blocks of 100 samples with stride 3 the window of 4 blocks must hold the samples 600..999, that is every
+ *  third number of the generator
+ *  @param There is no parameters
+ *  @return There is no return value
+ */
+
+void window(){
+    const uint64_t stride = 3, block = 100, blocks = 4, total = 10;
+    monitored<generator_1> watched(generator_1(6089, 0, 10000), stride, block, blocks);
+    generator_1 gen(6089, 0, 10000);
+    analys_state expected;
+
+    for (uint64_t i = 1; i <= stride * block * total; i++){
+        watched.next();
+        int v = gen.next();
+        if (i % stride == 0 && i / stride > block * (total - blocks))
+            expected.add(v);
+    }
+
+    monitor_snapshot snap = watched.snapshot();
+    check(snap.sampled == block * total, "sampled count");
+    check(snap.window == expected, "window of the last blocks");
+}
+
+/**
+ *  @brief Function for checking fill()
+ *  @details fill() in chunks of different lengths must give the same numbers, samples and window as the same number of calls of next()
+ *  @param There is no parameters
+ *  @return There is no return value
+ */
+
+void bulk(){
+    monitored<generator_1> one(generator_1(6089, 0, 10000), 64, 16, 4), many(generator_1(6089, 0, 10000), 64, 16, 4);
+    vector <int> by_one, by_many;
+
+    for (uint64_t n : {1, 62, 1, 64, 1023, 1024, 3000, 7, 0, 5000}){
+        for (uint64_t i = 0; i < n; i++)
+            by_one.push_back(one.next());
+        many.fill(back_inserter(by_many), n);
+    }
+
+    monitor_snapshot a = one.snapshot(), b = many.snapshot();
+    check(by_one == by_many, "fill() gives the numbers of next()");
+    check(one.gen.start == many.gen.start, "fill() leaves the generator where next() does");
+    check(a.sampled == b.sampled && a.sampled == by_one.size() / 64 / 16 * 16 && a.window == b.window, "fill() samples like next()");
+}
+
+/**
+ *  @brief Function for checking the snapshots taken during the work
+ *  @details A reader thread takes snapshots while the generator works. Every snapshot must be one published state: the bins add up
+ *  to the volume of the window, and the volume matches the sampled count
+ *  @param There is no parameters
+ *  @return There is no return value
+ */
+
+void consistency(){
+    const uint64_t block = 64, blocks = 4;
+    monitored<generator_1> watched(generator_1(6089, 0, 10000), 1, block, blocks);
+    atomic<bool> done{false};
+    uint64_t reads = 0, broken = 0, last = 0;
+
+    thread reader([&]{
+        while (!done.load(memory_order_acquire)){
+            monitor_snapshot snap = watched.snapshot();
+            uint64_t binned = 0;
+            for (auto b : snap.window.bins)
+                binned += b;
+            if (binned != snap.window.volume || snap.window.volume != min(snap.sampled / block, blocks) * block || snap.sampled < last)
+                broken++;
+            last = snap.sampled;
+            reads++;
+        }
+    });
+
+    for (int i = 0; i < 20000000; i++)
+        watched.next();
+    done.store(true, memory_order_release);
+    reader.join();
+
+    check(reads > 0, "snapshots were taken");
+    check(broken == 0, to_string(broken) + " of " + to_string(reads) + " snapshots are torn");
+}
+
+/**
+ *  @brief Function for checking the parameters
+ *  @details A zero stride, block or number of blocks must be refused
+ *  @param There is no parameters
+ *  @return There is no return value
+ */
+
+void parameters(){
+    const uint64_t wrong[][3] = {{0, 4096, 16}, {64, 0, 16}, {64, 4096, 0}};
+
+    for (auto &w : wrong){
+        bool refused = false;
+        try {
+            monitored<generator_1> watched(generator_1(6089, 0, 10000), w[0], w[1], w[2]);
+        }
+        catch (invalid_argument &){
+            refused = true;
+        }
+        check(refused, "stride " + to_string(w[0]) + ", block " + to_string(w[1]) + ", blocks " + to_string(w[2]) + " is refused");
+    }
+}
+
+int main(){
+    parameters();
+    cycles();
+    window();
+    bulk();
+    consistency();
+
+    if (failures == 0)
+        cout << "Monitor checks passed\n";
+    return failures == 0 ? 0 : 1;
+}
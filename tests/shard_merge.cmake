@@ -0,0 +1,60 @@
+# Runs lab4_shard for every shard, joins the files with lab4_merge and
+# compares the report with the one of "lab4 <generator> <dir> <volume>".
+# The merge without the last shard and with a shard of another volume must fail,
+# and so must a shard written to a missing directory.
+#
+# cmake -DLAB4=... -DSHARD=... -DMERGE=... -DWORK=<dir> -DGENERATOR=1
+#       -DVOLUME=<n> -DSHARDS=<n> -P shard_merge.cmake
+
+file(REMOVE_RECURSE ${WORK})
+file(MAKE_DIRECTORY ${WORK})
+
+set(files)
+math(EXPR last "${SHARDS} - 1")
+foreach(shard RANGE ${last})
+    execute_process(COMMAND ${SHARD} ${GENERATOR} ${VOLUME} ${shard} ${SHARDS} ${WORK}/shard${shard}.txt
+                    RESULT_VARIABLE result)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "lab4_shard ${shard} of ${SHARDS} failed: ${result}")
+    endif()
+    list(APPEND files ${WORK}/shard${shard}.txt)
+endforeach()
+
+execute_process(COMMAND ${MERGE} ${files} OUTPUT_VARIABLE merged RESULT_VARIABLE result)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "lab4_merge failed: ${result}\n${merged}")
+endif()
+
+execute_process(COMMAND ${LAB4} ${GENERATOR} ${WORK}/cache ${VOLUME} OUTPUT_VARIABLE single RESULT_VARIABLE result)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "lab4 failed: ${result}\n${single}")
+endif()
+
+string(FIND "${merged}" "Volume" at)
+if(at EQUAL -1)
+    message(FATAL_ERROR "lab4_merge printed no report:\n${merged}")
+endif()
+string(SUBSTRING "${merged}" ${at} -1 merged)
+
+if(NOT merged STREQUAL single)
+    message(FATAL_ERROR "Shards and one process differ\n--- lab4_merge\n${merged}\n--- lab4\n${single}")
+endif()
+
+list(REMOVE_AT files -1)
+execute_process(COMMAND ${MERGE} ${files} OUTPUT_QUIET RESULT_VARIABLE result)
+if(result EQUAL 0)
+    message(FATAL_ERROR "lab4_merge accepted a missing shard")
+endif()
+
+math(EXPR other "${VOLUME} + 1")
+execute_process(COMMAND ${SHARD} ${GENERATOR} ${other} ${last} ${SHARDS} ${WORK}/other.txt)
+execute_process(COMMAND ${MERGE} ${files} ${WORK}/other.txt OUTPUT_QUIET RESULT_VARIABLE result)
+if(result EQUAL 0)
+    message(FATAL_ERROR "lab4_merge accepted a shard of another volume")
+endif()
+
+execute_process(COMMAND ${SHARD} ${GENERATOR} ${VOLUME} 0 ${SHARDS} ${WORK}/missing/shard0.txt
+                OUTPUT_QUIET RESULT_VARIABLE result)
+if(result EQUAL 0)
+    message(FATAL_ERROR "lab4_shard reported success for a file it could not write")
+endif()
@@ -0,0 +1,260 @@
+#include "lab4_shuffle.h"
+#include "check.h"
+#include <numeric>
+#include <map>
+
+/**
+ *  @brief Class segment used to record the part of the sequence taken by one task
+ *  @details Offset of the task from the start of gen and the number of raw numbers it took
+ */
+
+class segment{
+public:
+    uint64_t offset = 0;
+    uint64_t used = 0;
+};
+
+segment segments[1024];
+atomic<size_t> segment_count{0};
+
+/**
+ *  @brief Class counting used to count the raw numbers taken from a generator
+ *  @details Every jump() starts a new segment, the raw numbers after it are counted in that segment
+ */
+
+template <class G>
+class counting : public G{
+public:
+    segment *seg = nullptr;
+    uint64_t calls = 0;
+
+    counting(uint64_t start_, int minV_, int maxV_) : G(start_, minV_, maxV_){
+    }
+
+    void jump(uint64_t steps) {
+        G::jump(steps);
+        seg = &segments[segment_count++];
+        seg->offset = steps;
+        seg->used = 0;
+    }
+
+    uint64_t raw() {
+        calls++;
+        if (seg)
+            seg->used++;
+        return G::raw();
+    }
+};
+
+bool is_permutation_of_iota(vector <int> array){
+    sort(array.begin(), array.end());
+    for (size_t i = 0; i < array.size(); i++)
+        if (array[i] != (int)i)
+            return false;
+    return true;
+}
+
+/**
+ *  @brief Function for checking that the shuffles give permutations
+ *  @details fisher_yates and parallel_shuffle with 2, 8 and 64 threads must give a permutation, the same for the same initial value
+ *  @param There is no parameters
+ *  @return There is no return value
+ */
+
+void permutations(){
+    const size_t n = 300000;
+    vector <int> first(n), second(n);
+
+    iota(first.begin(), first.end(), 0);
+    iota(second.begin(), second.end(), 0);
+    generator_1 a(6089, 0, 10000), b(6089, 0, 10000);
+    fisher_yates(first.begin(), first.end(), a);
+    fisher_yates(second.begin(), second.end(), b);
+    check(is_permutation_of_iota(first), "fisher_yates gives a permutation");
+    check(first == second, "fisher_yates is repeatable");
+
+    generator_2 x(6089, 0, 10000);
+    iota(first.begin(), first.end(), 0);
+    fisher_yates(first.begin(), first.end(), x);
+    check(is_permutation_of_iota(first), "fisher_yates with generator_2 gives a permutation");
+
+    for (unsigned threads : {2, 8, 64}){
+        iota(first.begin(), first.end(), 0);
+        iota(second.begin(), second.end(), 0);
+        generator_1 c(6089, 0, 10000), d(6089, 0, 10000);
+        parallel_shuffle(first.begin(), first.end(), c, threads);
+        parallel_shuffle(second.begin(), second.end(), d, threads);
+        check(is_permutation_of_iota(first), "parallel_shuffle gives a permutation with " + to_string(threads) + " threads");
+        check(first == second, "parallel_shuffle is repeatable with " + to_string(threads) + " threads");
+    }
+}
+
+/**
+ *  @brief Function for checking the frequencies of the permutations
+ *  @details All 24 orders of 4 elements must come about equally often from fisher_yates, and from merge_shuffled of two shuffled halves
+ *  @param There is no parameters
+ *  @return There is no return value
+ */
+
+void frequencies(){
+    const int trials = 48000;
+    map <vector <int>, int> shuffled, merged;
+    generator_1 gen(6089, 0, 10000);
+
+    for (int t = 0; t < trials; t++){
+        vector <int> array = {0, 1, 2, 3};
+        fisher_yates(array.begin(), array.end(), gen);
+        shuffled[array]++;
+
+        array = {0, 1, 2, 3};
+        fisher_yates(array.begin(), array.begin() + 2, gen);
+        fisher_yates(array.begin() + 2, array.end(), gen);
+        merge_shuffled(array.begin(), array.begin() + 2, array.end(), gen);
+        merged[array]++;
+    }
+
+    for (auto *counts : {&shuffled, &merged}){
+        bool even = counts->size() == 24;
+        for (auto &c : *counts)
+            even = even && abs(c.second - trials / 24) < trials / 24 / 10;
+        check(even, counts == &shuffled ? "fisher_yates orders are equally likely" : "merge_shuffled orders are equally likely");
+    }
+}
+
+/**
+ *  @brief Function for checking the budgets of parallel_shuffle
+ *  @details Every task must stay inside its shuffle_budget segment, and gen must end exactly after the last segment
+ *  @param There is no parameters
+ *  @return There is no return value
+ */
+
+void budgets(){
+    const uint64_t n = 300000;
+
+    for (unsigned threads : {2, 8, 64}){
+        uint64_t parts = threads, total = 0;
+        vector <uint64_t> bounds, expected;
+        for (uint64_t k = 0; k <= parts; k++)
+            bounds.push_back(n * k / parts);
+        for (uint64_t k = 0; k < parts; k++){
+            expected.push_back(total);
+            total += shuffle_budget(bounds[k + 1] - bounds[k]);
+        }
+        for (uint64_t width = 1; width < parts; width *= 2)
+            for (uint64_t k = 0; k < parts; k += 2 * width){
+                expected.push_back(total);
+                total += shuffle_budget(bounds[k + 2 * width] - bounds[k]);
+            }
+        expected.push_back(total);
+
+        vector <int> array(n);
+        iota(array.begin(), array.end(), 0);
+        segment_count = 0;
+        counting<generator_1> gen(6089, 0, 10000);
+        parallel_shuffle(array.begin(), array.end(), gen, threads);
+
+        vector <segment> used(segments, segments + segment_count);
+        sort(used.begin(), used.end(), [](const segment &a, const segment &b){ return a.offset < b.offset; });
+        vector <uint64_t> offsets;
+        bool inside = true;
+        for (size_t i = 0; i < used.size(); i++){
+            offsets.push_back(used[i].offset);
+            if (i + 1 < used.size())
+                inside = inside && used[i].offset + used[i].used <= used[i + 1].offset;
+        }
+        string name = " with " + to_string(threads) + " threads";
+
+        check(offsets == expected, "segments of the tasks" + name);
+        check(inside, "every task stays in its segment" + name);
+        check(gen.calls == 0, "gen itself is not used" + name);
+
+        generator_1 moved(6089, 0, 10000);
+        moved.jump(total);
+        check(gen.start == moved.start, "gen ends total steps ahead" + name);
+    }
+}
+
+/**
+ *  @brief Function for checking the random indices
+ *  @details uniform_index must stay below n, also on the rejection path of generator_2, where about half of the raw numbers
+ *  are rejected for n just above randM / 2
+ *  @param There is no parameters
+ *  @return There is no return value
+ */
+
+void indices(){
+    const uint64_t half = generator_2::randM / 2 + 1;
+    counting<generator_1> lcg(6089, 0, 10000);
+    counting<generator_2> xorshift(6089, 0, 10000);
+    bool below = true;
+
+    for (uint64_t n : {uint64_t(1), uint64_t(2), uint64_t(3), uint64_t(10000), (uint64_t(1) << 31) + 1, (uint64_t(1) << 32) - 1})
+        for (int i = 0; i < 10000; i++)
+            below = below && uniform_index(lcg, n) < n;
+    check(below, "uniform_index of generator_1 is below n");
+
+    for (uint64_t n : {uint64_t(1), uint64_t(3), uint64_t(10000), half, generator_2::randM - 1})
+        for (int i = 0; i < 10000; i++)
+            below = below && uniform_index(xorshift, n) < n;
+    check(below, "uniform_index of generator_2 is below n");
+
+    xorshift.calls = 0;
+    for (int i = 0; i < 10000; i++)
+        below = below && uniform_index(xorshift, half) < half;
+    check(below && xorshift.calls > 15000, "rejection path of generator_2 is taken and stays below n");
+}
+
+/**
+ *  @brief Function for checking the samples
+ *  @details reservoir_sample must return min(k, length) different elements, each element is taken about k / length of the times.
+ *  bernoulli_sample must take about p * n elements, none for p <= 0 and all for p >= 1
+ *  @param There is no parameters
+ *  @return There is no return value
+ */
+
+void samples(){
+    generator_1 gen(6089, 0, 10000);
+    vector <int> input(20);
+    iota(input.begin(), input.end(), 0);
+
+    for (size_t k : {0, 5, 20, 30}){
+        vector <int> sample = reservoir_sample(input.begin(), input.end(), k, gen);
+        sort(sample.begin(), sample.end());
+        check(sample.size() == min(k, input.size()) && unique(sample.begin(), sample.end()) == sample.end(),
+              "reservoir_sample of " + to_string(k) + " from 20");
+    }
+
+    const int trials = 20000;
+    vector <int> picked(input.size());
+    for (int t = 0; t < trials; t++)
+        for (int v : reservoir_sample(input.begin(), input.end(), 5, gen))
+            picked[v]++;
+    bool even = true;
+    for (int p : picked)
+        even = even && abs(p - trials / 4) < trials / 4 / 20;
+    check(even, "reservoir_sample takes every element equally often");
+
+    vector <int> big(1000000), out;
+    iota(big.begin(), big.end(), 0);
+    bernoulli_sample(big.begin(), big.end(), 0.1, gen, back_inserter(out));
+    check(abs((long)out.size() - 100000) < 1000, "bernoulli_sample takes about p * n elements");
+    check(is_sorted(out.begin(), out.end()) && adjacent_find(out.begin(), out.end()) == out.end(), "bernoulli_sample keeps the order");
+
+    for (double p : {-1.0, 0.0, 1.0, 2.0}){
+        out.clear();
+        bernoulli_sample(big.begin(), big.end(), p, gen, back_inserter(out));
+        check(out.size() == (p >= 1 ? big.size() : 0), "bernoulli_sample with p = " + to_string(p));
+    }
+}
+
+int main(){
+    permutations();
+    frequencies();
+    budgets();
+    indices();
+    samples();
+
+    if (failures == 0)
+        cout << "Shuffle checks passed\n";
+    return failures == 0 ? 0 : 1;
+}